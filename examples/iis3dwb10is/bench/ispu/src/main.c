@@ -0,0 +1,393 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#include "peripherals.h"
+#include "reg_map.h"
+#include "ispu_float.h"
+#include "ispu_dsp.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#define MIN_BLOCK_SIZE 16u
+#define MAX_BLOCK_SIZE 2048u
+#define MIN_FFT_LEN 32u
+#define MAX_TAPS 256u
+#define MAX_STAGES 8u
+#define DEC 4u
+
+// each measurement repeats the call so that it covers at least REP_SAMPLES samples
+#define REP_SAMPLES 4096u
+
+enum sweep {
+	SWEEP_BLOCK, // block size only
+	SWEEP_TAPS, // block size and number of FIR taps
+	SWEEP_STAGES, // block size and number of biquad stages
+	SWEEP_FFT, // transform length
+};
+
+struct bench_func {
+	enum sweep sweep;
+	uint16_t max_size; // largest block size fitting in the buffers
+	int (*setup)(uint16_t size, uint16_t param); // not timed, NULL if not needed
+	void (*run)(uint16_t size);
+};
+
+static volatile uint16_t int_status;
+
+// buf_a is the input of all the functions (aligned for the transforms), buf_b the output, buf_c the second input
+// or the state of the FIR filters
+static float __attribute__ ((aligned(8192))) buf_a[2 * MAX_BLOCK_SIZE];
+static float __attribute__ ((aligned(8192))) buf_b[2 * MAX_BLOCK_SIZE];
+static float buf_c[MAX_BLOCK_SIZE + MAX_TAPS];
+static float __attribute__ ((aligned(4096))) state_opt[MAX_TAPS];
+static float coeffs[MAX_TAPS];
+static float biquad_coeffs[5 * MAX_STAGES];
+static float biquad_state[4 * MAX_STAGES];
+
+static float res;
+static uint32_t idx;
+static uint32_t count;
+
+static struct ispu_biquad_casd_df1_inst_f32 df1;
+static struct ispu_biquad_casd_df2T_inst_f32 df2T;
+static struct ispu_fir_instance_f32 fir;
+static struct ispu_fir_instance_f32_opt fir_opt;
+static struct ispu_fir_decimate_instance_f32 fir_dec;
+static struct ispu_fir_decimate_instance_f32_opt fir_dec_opt;
+static struct ispu_rfft_instance_f32 rfft;
+static struct ispu_hilbert_instance_f32 hilbert;
+static struct ispu_cepstrum_instance_f32 cepstrum;
+
+static const uint16_t taps[] = { 4, 8, 16, 25, 32, 64, 128, 256 };
+static const uint16_t stages[] = { 1, 2, 4, 8 };
+
+static uint32_t seed;
+static uint8_t func_idx, size_idx, param_idx;
+static uint16_t case_idx;
+
+// pseudo-random input in [0.5, 1.5), positive for the square roots and the logarithms
+static void fill_input(void)
+{
+	seed = 1u;
+
+	for (uint16_t i = 0; i < 2 * MAX_BLOCK_SIZE; i++) {
+		seed = seed * 1664525u + 1013904223u;
+		buf_a[i] = 0.5f + (float)(seed >> 8) * (1.0f / 16777216.0f);
+	}
+
+	for (uint16_t i = 0; i < MAX_BLOCK_SIZE; i++)
+		buf_c[i] = buf_a[2 * MAX_BLOCK_SIZE - 1 - i];
+}
+
+static int setup_df1(uint16_t size, uint16_t param)
+{
+	(void)size;
+	ispu_biquad_cascade_df1_init_f32(&df1, (uint8_t)param, biquad_coeffs, biquad_state);
+
+	return 0;
+}
+
+static int setup_df2T(uint16_t size, uint16_t param)
+{
+	(void)size;
+	ispu_biquad_cascade_df2T_init_f32(&df2T, (uint8_t)param, biquad_coeffs, biquad_state);
+
+	return 0;
+}
+
+static int setup_fir(uint16_t size, uint16_t param)
+{
+	ispu_fir_init_f32(&fir, param, coeffs, buf_c, size);
+
+	return 0;
+}
+
+static int setup_fir_opt(uint16_t size, uint16_t param)
+{
+	(void)size;
+
+	return ispu_fir_init_f32_opt(&fir_opt, param, coeffs, state_opt);
+}
+
+static int setup_fir_dec(uint16_t size, uint16_t param)
+{
+	return ispu_fir_decimate_init_f32(&fir_dec, param, DEC, coeffs, buf_c, size);
+}
+
+static int setup_fir_dec_opt(uint16_t size, uint16_t param)
+{
+	return ispu_fir_decimate_init_f32_opt(&fir_dec_opt, param, DEC, coeffs, state_opt, size);
+}
+
+static int setup_rfft(uint16_t size, uint16_t param)
+{
+	(void)param;
+
+	return ispu_rfft_init_f32(&rfft, size);
+}
+
+static int setup_hilbert(uint16_t size, uint16_t param)
+{
+	(void)param;
+
+	return ispu_hilbert_init_f32(&hilbert, size);
+}
+
+static int setup_cepstrum(uint16_t size, uint16_t param)
+{
+	(void)param;
+
+	return ispu_cepstrum_init_f32(&cepstrum, size);
+}
+
+// empty function, measures the overhead of the measurement loop
+static void __attribute__ ((noinline)) run_none(uint16_t size)
+{
+	(void)size;
+	__asm__ volatile ("");
+}
+
+static void run_abs(uint16_t size) { ispu_abs_f32(buf_a, buf_b, size); }
+static void run_add(uint16_t size) { ispu_add_f32(buf_a, buf_c, buf_b, size); }
+static void run_clip(uint16_t size) { ispu_clip_f32(buf_a, buf_b, 0.75f, 1.25f, size); }
+static void run_inv_norm3(uint16_t size) { ispu_inv_norm3_f32(buf_a, buf_b, size); }
+static void run_mult(uint16_t size) { ispu_mult_f32(buf_a, buf_c, buf_b, size); }
+static void run_negate(uint16_t size) { ispu_negate_f32(buf_a, buf_b, size); }
+static void run_norm3(uint16_t size) { ispu_norm3_f32(buf_a, buf_b, size); }
+static void run_normalize3(uint16_t size) { ispu_normalize3_f32(buf_a, buf_b, size); }
+static void run_normalize4(uint16_t size) { ispu_normalize4_f32(buf_a, buf_b, size); }
+static void run_offset(uint16_t size) { ispu_offset_f32(buf_a, 0.5f, buf_b, size); }
+static void run_scale(uint16_t size) { ispu_scale_f32(buf_a, 0.5f, buf_b, size); }
+static void run_sub(uint16_t size) { ispu_sub_f32(buf_a, buf_c, buf_b, size); }
+static void run_square(uint16_t size) { ispu_square_f32(buf_a, buf_b, size); }
+static void run_vsqrt(uint16_t size) { ispu_vsqrt_f32(buf_a, buf_b, size); }
+static void run_cmplx_mag(uint16_t size) { ispu_cmplx_mag_f32(buf_a, buf_b, size); }
+static void run_cmplx_mag_squared(uint16_t size) { ispu_cmplx_mag_squared_f32(buf_a, buf_b, size); }
+static void run_df1(uint16_t size) { ispu_biquad_cascade_df1_f32(&df1, buf_a, buf_b, size); }
+static void run_df2T(uint16_t size) { ispu_biquad_cascade_df2T_f32(&df2T, buf_a, buf_b, size); }
+static void run_fir(uint16_t size) { ispu_fir_f32(&fir, buf_a, buf_b, size); }
+static void run_fir_opt(uint16_t size) { ispu_fir_f32_opt(&fir_opt, buf_a, buf_b, size); }
+static void run_fir_dec(uint16_t size) { ispu_fir_decimate_f32(&fir_dec, buf_a, buf_b, size); }
+static void run_fir_dec_opt(uint16_t size) { ispu_fir_decimate_f32_opt(&fir_dec_opt, buf_a, buf_b, size); }
+static void run_absmax(uint16_t size) { ispu_absmax_f32(buf_a, &res, &idx, size); }
+static void run_absmax_no_idx(uint16_t size) { ispu_absmax_no_idx_f32(buf_a, &res, size); }
+static void run_absmin(uint16_t size) { ispu_absmin_f32(buf_a, &res, &idx, size); }
+static void run_absmin_no_idx(uint16_t size) { ispu_absmin_no_idx_f32(buf_a, &res, size); }
+static void run_accumulate(uint16_t size) { ispu_accumulate_f32(buf_a, &res, size); }
+static void run_level_crossings(uint16_t size) { ispu_level_crossings_f32(buf_a, 1.0f, &count, size, 1); }
+static void run_max(uint16_t size) { ispu_max_f32(buf_a, &res, &idx, size); }
+static void run_max_no_idx(uint16_t size) { ispu_max_no_idx_f32(buf_a, &res, size); }
+static void run_mean(uint16_t size) { ispu_mean_f32(buf_a, &res, size); }
+static void run_mean_crossings(uint16_t size) { ispu_mean_crossings_f32(buf_a, &count, size, 1); }
+static void run_min(uint16_t size) { ispu_min_f32(buf_a, &res, &idx, size); }
+static void run_min_no_idx(uint16_t size) { ispu_min_no_idx_f32(buf_a, &res, size); }
+static void run_peak_count(uint16_t size) { ispu_peak_count_f32(buf_a, 0.75f, 1.25f, &count, size, 1); }
+static void run_power(uint16_t size) { ispu_power_f32(buf_a, &res, size); }
+static void run_rms(uint16_t size) { ispu_rms_f32(buf_a, &res, size); }
+static void run_std(uint16_t size) { ispu_std_f32(buf_a, &res, size); }
+static void run_var(uint16_t size) { ispu_var_f32(buf_a, &res, size); }
+static void run_rfft(uint16_t size) { (void)size; ispu_rfft_f32(&rfft, buf_a); }
+static void run_irfft(uint16_t size) { (void)size; ispu_irfft_f32(&rfft, buf_a); }
+static void run_hilbert(uint16_t size) { (void)size; ispu_hilbert_f32(&hilbert, buf_a, buf_b); }
+static void run_cepstrum(uint16_t size) { (void)size; ispu_cepstrum_f32(&cepstrum, buf_a); }
+static void run_cepstrum_peak(uint16_t size) { ispu_cepstrum_peak_f32(buf_a, 0, size - 1, &res, &idx); }
+static void run_hamming(uint16_t size) { ispu_hamming_f32(buf_b, size); }
+static void run_hanning(uint16_t size) { ispu_hanning_f32(buf_b, size); }
+
+// the index in this table is the function identifier of the outputs (see the list in scripts/bench_parse.py)
+static const struct bench_func funcs[] = {
+	{ SWEEP_BLOCK, MAX_BLOCK_SIZE, NULL, run_none },
+	{ SWEEP_BLOCK, MAX_BLOCK_SIZE, NULL, run_abs },
+	{ SWEEP_BLOCK, MAX_BLOCK_SIZE, NULL, run_add },
+	{ SWEEP_BLOCK, MAX_BLOCK_SIZE, NULL, run_clip },
+	{ SWEEP_BLOCK, MAX_BLOCK_SIZE / 2, NULL, run_inv_norm3 },
+	{ SWEEP_BLOCK, MAX_BLOCK_SIZE, NULL, run_mult },
+	{ SWEEP_BLOCK, MAX_BLOCK_SIZE, NULL, run_negate },
+	{ SWEEP_BLOCK, MAX_BLOCK_SIZE / 2, NULL, run_norm3 },
+	{ SWEEP_BLOCK, MAX_BLOCK_SIZE / 2, NULL, run_normalize3 },
+	{ SWEEP_BLOCK, MAX_BLOCK_SIZE / 2, NULL, run_normalize4 },
+	{ SWEEP_BLOCK, MAX_BLOCK_SIZE, NULL, run_offset },
+	{ SWEEP_BLOCK, MAX_BLOCK_SIZE, NULL, run_scale },
+	{ SWEEP_BLOCK, MAX_BLOCK_SIZE, NULL, run_sub },
+	{ SWEEP_BLOCK, MAX_BLOCK_SIZE, NULL, run_square },
+	{ SWEEP_BLOCK, MAX_BLOCK_SIZE, NULL, run_vsqrt },
+	{ SWEEP_BLOCK, MAX_BLOCK_SIZE, NULL, run_cmplx_mag },
+	{ SWEEP_BLOCK, MAX_BLOCK_SIZE, NULL, run_cmplx_mag_squared },
+	{ SWEEP_STAGES, MAX_BLOCK_SIZE, setup_df1, run_df1 },
+	{ SWEEP_STAGES, MAX_BLOCK_SIZE, setup_df2T, run_df2T },
+	{ SWEEP_TAPS, MAX_BLOCK_SIZE, setup_fir, run_fir },
+	{ SWEEP_TAPS, MAX_BLOCK_SIZE, setup_fir_opt, run_fir_opt },
+	{ SWEEP_TAPS, MAX_BLOCK_SIZE, setup_fir_dec, run_fir_dec },
+	{ SWEEP_TAPS, MAX_BLOCK_SIZE, setup_fir_dec_opt, run_fir_dec_opt },
+	{ SWEEP_BLOCK, MAX_BLOCK_SIZE, NULL, run_absmax },
+	{ SWEEP_BLOCK, MAX_BLOCK_SIZE, NULL, run_absmax_no_idx },
+	{ SWEEP_BLOCK, MAX_BLOCK_SIZE, NULL, run_absmin },
+	{ SWEEP_BLOCK, MAX_BLOCK_SIZE, NULL, run_absmin_no_idx },
+	{ SWEEP_BLOCK, MAX_BLOCK_SIZE, NULL, run_accumulate },
+	{ SWEEP_BLOCK, MAX_BLOCK_SIZE, NULL, run_level_crossings },
+	{ SWEEP_BLOCK, MAX_BLOCK_SIZE, NULL, run_max },
+	{ SWEEP_BLOCK, MAX_BLOCK_SIZE, NULL, run_max_no_idx },
+	{ SWEEP_BLOCK, MAX_BLOCK_SIZE, NULL, run_mean },
+	{ SWEEP_BLOCK, MAX_BLOCK_SIZE, NULL, run_mean_crossings },
+	{ SWEEP_BLOCK, MAX_BLOCK_SIZE, NULL, run_min },
+	{ SWEEP_BLOCK, MAX_BLOCK_SIZE, NULL, run_min_no_idx },
+	{ SWEEP_BLOCK, MAX_BLOCK_SIZE, NULL, run_peak_count },
+	{ SWEEP_BLOCK, MAX_BLOCK_SIZE, NULL, run_power },
+	{ SWEEP_BLOCK, MAX_BLOCK_SIZE, NULL, run_rms },
+	{ SWEEP_BLOCK, MAX_BLOCK_SIZE, NULL, run_std },
+	{ SWEEP_BLOCK, MAX_BLOCK_SIZE, NULL, run_var },
+	{ SWEEP_FFT, MAX_BLOCK_SIZE, setup_rfft, run_rfft },
+	{ SWEEP_FFT, MAX_BLOCK_SIZE, setup_rfft, run_irfft },
+	{ SWEEP_FFT, MAX_BLOCK_SIZE, setup_hilbert, run_hilbert },
+	{ SWEEP_FFT, MAX_BLOCK_SIZE, setup_cepstrum, run_cepstrum },
+	{ SWEEP_BLOCK, MAX_BLOCK_SIZE, NULL, run_cepstrum_peak },
+	{ SWEEP_BLOCK, MAX_BLOCK_SIZE, NULL, run_hamming },
+	{ SWEEP_BLOCK, MAX_BLOCK_SIZE, NULL, run_hanning },
+};
+
+#define NUM_FUNCS (sizeof(funcs) / sizeof(funcs[0]))
+
+static uint8_t num_params(enum sweep sweep)
+{
+	if (sweep == SWEEP_TAPS)
+		return sizeof(taps) / sizeof(taps[0]);
+	if (sweep == SWEEP_STAGES)
+		return sizeof(stages) / sizeof(stages[0]);
+
+	return 1;
+}
+
+static uint16_t param_value(enum sweep sweep, uint8_t i)
+{
+	if (sweep == SWEEP_TAPS)
+		return taps[i];
+	if (sweep == SWEEP_STAGES)
+		return stages[i];
+
+	return 0;
+}
+
+static uint16_t first_size(enum sweep sweep)
+{
+	return sweep == SWEEP_FFT ? MIN_FFT_LEN : MIN_BLOCK_SIZE;
+}
+
+// moves to the next case: parameters first, then block sizes, then functions, restarting when the sweep is complete
+static void next_case(void)
+{
+	const struct bench_func *func = &funcs[func_idx];
+
+	param_idx++;
+	if (param_idx < num_params(func->sweep))
+		return;
+
+	param_idx = 0;
+	size_idx++;
+	if ((first_size(func->sweep) << size_idx) <= func->max_size)
+		return;
+
+	func_idx++;
+	if (func_idx == NUM_FUNCS) {
+		func_idx = 0;
+		case_idx = 0;
+	}
+	size_idx = 0;
+}
+
+void __attribute__ ((signal)) algo_00_init(void)
+{
+	func_idx = 0;
+	size_idx = 0;
+	param_idx = 0;
+	case_idx = 0;
+
+	for (uint16_t i = 0; i < MAX_TAPS; i++)
+		coeffs[i] = 1.0f / (float)(i + 1);
+
+	// stable low-pass sections (b0, b1, b2, -a1, -a2)
+	for (uint8_t i = 0; i < MAX_STAGES; i++) {
+		biquad_coeffs[5 * i + 0] = 0.2f;
+		biquad_coeffs[5 * i + 1] = 0.4f;
+		biquad_coeffs[5 * i + 2] = 0.2f;
+		biquad_coeffs[5 * i + 3] = 0.5f;
+		biquad_coeffs[5 * i + 4] = -0.3f;
+	}
+}
+
+void __attribute__ ((signal)) algo_00(void)
+{
+	const struct bench_func *func = &funcs[func_idx];
+	uint16_t size = first_size(func->sweep) << size_idx;
+	uint16_t param = param_value(func->sweep, param_idx);
+	uint16_t reps = size < REP_SAMPLES ? REP_SAMPLES / size : 1u;
+
+	// the input is restored at each case, as some functions work in place
+	fill_input();
+
+	if (func->setup == NULL || func->setup(size, param) == 0) {
+		// INT2 is kept low while the function runs, its duration is measured by the host
+		cast_uint8_t(ISPU_INT_PIN) = 0u;
+		for (uint16_t i = 0; i < reps; i++)
+			func->run(size);
+		cast_uint8_t(ISPU_INT_PIN) = 2u;
+
+		cast_uint16_t(ISPU_DOUT_00) = case_idx;
+		cast_uint16_t(ISPU_DOUT_01) = func_idx;
+		cast_uint16_t(ISPU_DOUT_02) = size;
+		cast_uint16_t(ISPU_DOUT_03) = param;
+		cast_uint16_t(ISPU_DOUT_04) = reps;
+		case_idx++;
+
+		int_status = int_status | 0x1u;
+	}
+
+	next_case();
+}
+
+int main(void)
+{
+	// set boot end flag
+	uint8_t status = cast_uint8_t(ISPU_STATUS);
+	status = status | 0x40u;
+	cast_uint8_t(ISPU_STATUS) = status;
+
+	// enable algorithms interrupt only, so that nothing else runs during the measurements
+	cast_uint8_t(ISPU_GLB_CALL_EN) = 0x01;
+
+	while (true) {
+		stop_and_wait_start_pulse;
+
+		// reset status registers and interrupts (INT2 is high while no measurement is in progress)
+		int_status = 0u;
+		cast_uint16_t(ISPU_INT_STATUS) = 0u;
+		cast_uint8_t(ISPU_INT_PIN) = 2u;
+
+		// trigger enabled algorithms execution
+		cast_uint32_t(ISPU_CALL_EN) = cast_uint16_t(ISPU_ALGO) << 4;
+
+		// wait for all algorithms execution
+		while (cast_uint32_t(ISPU_CALL_EN & 0xFFFF0) != 0u)
+			;
+
+		// get interrupt flags
+		uint8_t int_pin = 0x02u;
+		int_pin |= ((int_status & cast_uint16_t(ISPU_INT1_CTRL)) > 0u) ? 0x01u : 0x00u;
+
+		// set status registers and generate interrupts
+		cast_uint16_t(ISPU_INT_STATUS) = int_status;
+		cast_uint8_t(ISPU_INT_PIN) = int_pin;
+	}
+}
@@ -0,0 +1,218 @@
+##############################################################################
+# Copyright(c) 2026 STMicroelectronics.
+# All rights reserved.
+#
+# This software is licensed under terms that can be found in the LICENSE file
+# in the root directory of this software component.
+# If no LICENSE file comes with this software, it is provided AS-IS.
+##############################################################################
+
+"""Convert the measurements of the ISPU DSP benchmark to CSV or JSON.
+
+The measurements can be taken:
+  - on the device, with the log of the nucleo_ispu_test_header firmware (outputs and execution time enabled),
+    where the outputs of a case, read on INT1, are printed before the execution time measured on the rising edge of
+    INT2 of the same case;
+  - on the host, with the outputs (-o) and the INT2 pulses (-p) written by the ISPU emulator, matched by sample.
+
+Usage:
+  python bench_parse.py --uart log.txt [--clock 40] [--format csv|json] [--output results.csv]
+  python bench_parse.py --emu out.csv pulses.csv [--clock 40] [--format csv|json] [--output results.json]
+"""
+
+from typing import Dict, List, Optional, Tuple
+import argparse
+import csv
+import json
+import sys
+
+# same order as the funcs table in ispu/src/main.c
+FUNCTIONS = [
+    "none",
+    "ispu_abs_f32",
+    "ispu_add_f32",
+    "ispu_clip_f32",
+    "ispu_inv_norm3_f32",
+    "ispu_mult_f32",
+    "ispu_negate_f32",
+    "ispu_norm3_f32",
+    "ispu_normalize3_f32",
+    "ispu_normalize4_f32",
+    "ispu_offset_f32",
+    "ispu_scale_f32",
+    "ispu_sub_f32",
+    "ispu_square_f32",
+    "ispu_vsqrt_f32",
+    "ispu_cmplx_mag_f32",
+    "ispu_cmplx_mag_squared_f32",
+    "ispu_biquad_cascade_df1_f32",
+    "ispu_biquad_cascade_df2T_f32",
+    "ispu_fir_f32",
+    "ispu_fir_f32_opt",
+    "ispu_fir_decimate_f32",
+    "ispu_fir_decimate_f32_opt",
+    "ispu_absmax_f32",
+    "ispu_absmax_no_idx_f32",
+    "ispu_absmin_f32",
+    "ispu_absmin_no_idx_f32",
+    "ispu_accumulate_f32",
+    "ispu_level_crossings_f32",
+    "ispu_max_f32",
+    "ispu_max_no_idx_f32",
+    "ispu_mean_f32",
+    "ispu_mean_crossings_f32",
+    "ispu_min_f32",
+    "ispu_min_no_idx_f32",
+    "ispu_peak_count_f32",
+    "ispu_power_f32",
+    "ispu_rms_f32",
+    "ispu_std_f32",
+    "ispu_var_f32",
+    "ispu_rfft_f32",
+    "ispu_irfft_f32",
+    "ispu_hilbert_f32",
+    "ispu_cepstrum_f32",
+    "ispu_cepstrum_peak_f32",
+    "ispu_hamming_f32",
+    "ispu_hanning_f32",
+]
+
+# meaning of the parameter of the case
+STAGES_FUNCTIONS = ("ispu_biquad_cascade_df1_f32", "ispu_biquad_cascade_df2T_f32")
+TAPS_FUNCTIONS = ("ispu_fir_f32", "ispu_fir_f32_opt", "ispu_fir_decimate_f32", "ispu_fir_decimate_f32_opt")
+
+# outputs of a case: case, function, block size, parameter, repetitions
+NUM_OUTPUTS = 5
+
+# execution time line of the test header firmware: instantaneous, minimum, maximum, average
+NUM_TIMES = 4
+
+FIELDS = ["function", "block_size", "taps", "stages", "repetitions", "runs", "time_us", "cycles", "cycles_per_sample"]
+
+Measurement = Tuple[int, int, int, int, float]  # function, block size, parameter, repetitions, time [us]
+
+
+def _numbers(line: str) -> Optional[List[float]]:
+    try:
+        return [float(tok) for tok in line.replace(",", " ").split()]
+    except ValueError:
+        return None
+
+
+def parse_uart(path: str) -> List[Measurement]:
+    """Pair the outputs of each case with the execution time printed after them."""
+    measurements = []
+    outputs = None
+
+    with open(path, "r", encoding="utf-8", errors="ignore") as f:
+        for line in f:
+            values = _numbers(line)
+            if not values:
+                continue
+            if len(values) == NUM_OUTPUTS:
+                # outputs not followed by a time (e.g. the time line was lost) are replaced by the next ones
+                outputs = [int(v) for v in values]
+            elif len(values) == NUM_TIMES and outputs is not None:
+                _, func, size, param, reps = outputs
+                measurements.append((func, size, param, reps, values[0]))
+                outputs = None
+
+    return measurements
+
+
+def parse_emu(out_path: str, pulse_path: str) -> List[Measurement]:
+    """Pair the outputs and the INT2 pulses logged by the emulator in the same sample."""
+    pulses = {}
+    with open(pulse_path, "r", newline="") as f:
+        for row in csv.DictReader(f):
+            pulses[int(row["Sample"])] = float(row["Time [us]"])
+
+    measurements = []
+    with open(out_path, "r", newline="") as f:
+        for row in csv.DictReader(f):
+            sample = int(row["Sample"])
+            if sample not in pulses:
+                continue
+            measurements.append((int(row["Function"]), int(row["Block size"]), int(row["Parameter"]),
+                                 int(row["Repetitions"]), pulses[sample]))
+
+    return measurements
+
+
+def summarize(measurements: List[Measurement], clock_mhz: float) -> List[Dict]:
+    """Keep the fastest run of each case and remove the overhead of the measurement loop."""
+    best: Dict[Tuple[int, int, int], Tuple[int, float, int]] = {}
+    for func, size, param, reps, time_us in measurements:
+        key = (func, size, param)
+        _, prev, runs = best.get(key, (reps, time_us, 0))
+        best[key] = (reps, min(prev, time_us), runs + 1)
+
+    results = []
+    for (func, size, param), (reps, time_us, runs) in sorted(best.items()):
+        if func == 0 or func >= len(FUNCTIONS):
+            continue
+
+        # the overhead case runs the same number of repetitions for the same block size
+        overhead = best.get((0, size, 0), (reps, 0.0, 0))[1]
+        per_call = max(time_us - overhead, 0.0) / reps
+        name = FUNCTIONS[func]
+
+        results.append({
+            "function": name,
+            "block_size": size,
+            "taps": param if name in TAPS_FUNCTIONS else None,
+            "stages": param if name in STAGES_FUNCTIONS else None,
+            "repetitions": reps,
+            "runs": runs,
+            "time_us": round(per_call, 4),
+            "cycles": round(per_call * clock_mhz, 1),
+            "cycles_per_sample": round(per_call * clock_mhz / size, 3),
+        })
+
+    return results
+
+
+def write_results(results: List[Dict], fmt: str, clock_mhz: float, out) -> None:
+    if fmt == "json":
+        json.dump({"clock_mhz": clock_mhz, "results": results}, out, indent=2)
+        out.write("\n")
+    else:
+        writer = csv.DictWriter(out, fieldnames=FIELDS, lineterminator="\n")
+        writer.writeheader()
+        for res in results:
+            writer.writerow({k: ("" if v is None else v) for k, v in res.items()})
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description="Convert the measurements of the ISPU DSP benchmark to CSV or JSON")
+    source = parser.add_mutually_exclusive_group(required=True)
+    source.add_argument("--uart", metavar="LOG", help="log of the nucleo_ispu_test_header firmware")
+    source.add_argument("--emu", nargs=2, metavar=("OUTPUTS", "PULSES"),
+                        help="output and INT2 pulse files of the ISPU emulator (-o and -p options)")
+    parser.add_argument("--clock", type=float, default=40.0, help="ISPU clock [MHz] (default: 40)")
+    parser.add_argument("--format", choices=("csv", "json"), default="csv", help="output format (default: csv)")
+    parser.add_argument("--output", help="output file (default: stdout)")
+    args = parser.parse_args()
+
+    if args.uart:
+        measurements = parse_uart(args.uart)
+    else:
+        measurements = parse_emu(args.emu[0], args.emu[1])
+
+    if not measurements:
+        print("No measurements found", file=sys.stderr)
+        return 1
+
+    results = summarize(measurements, args.clock)
+
+    if args.output:
+        with open(args.output, "w", newline="") as out:
+            write_results(results, args.format, args.clock, out)
+    else:
+        write_results(results, args.format, args.clock, sys.stdout)
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
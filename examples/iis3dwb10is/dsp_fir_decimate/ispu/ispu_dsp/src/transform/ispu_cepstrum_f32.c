@@ -0,0 +1,58 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#include "ispu_dsp.h"
+
+#include <stdint.h>
+#include <math.h>
+
+// lower bound of the power spectrum, avoids log(0) on empty bins
+#define POWER_FLOOR 1.0e-20f
+
+int ispu_cepstrum_init_f32(struct ispu_cepstrum_instance_f32 *inst, uint16_t cepstrum_len)
+{
+	int res = ispu_rfft_init_f32(&inst->rfft_inst, cepstrum_len);
+	if (res == 0)
+		inst->cepstrum_len = cepstrum_len;
+
+	return res;
+}
+
+void ispu_cepstrum_f32(struct ispu_cepstrum_instance_f32 *inst, float *data)
+{
+	uint16_t half = inst->cepstrum_len / 2u;
+
+	ispu_rfft_f32(&inst->rfft_inst, data);
+
+	// log magnitude spectrum (log|X| = 0.5 * log|X|^2), real and even so that all the imaginary parts are zero
+	data[0] = 0.5f * logf(data[0] * data[0] + POWER_FLOOR);
+	data[1] = 0.5f * logf(data[1] * data[1] + POWER_FLOOR);
+
+	for (uint16_t k = 1; k < half; k++) {
+		float re = data[2u * k];
+		float im = data[2u * k + 1u];
+
+		data[2u * k] = 0.5f * logf(re * re + im * im + POWER_FLOOR);
+		data[2u * k + 1u] = 0.0f;
+	}
+
+	ispu_irfft_f32(&inst->rfft_inst, data);
+}
+
+void ispu_cepstrum_peak_f32(const float *src, uint16_t q_min, uint16_t q_max, float *res, uint32_t *idx)
+{
+	ispu_max_f32(&src[q_min], res, idx, (uint32_t)(q_max - q_min) + 1u);
+	*idx += q_min;
+}
+
@@ -51,6 +51,17 @@ void ispu_add_f32(const float *src0, const float *src1, float *dst, uint32_t blo
  */
 void ispu_clip_f32(const float *src, float *dst, float low, float high, uint32_t block_size);
 
+/**
+ * @brief Floating-point 3-axis vector inverse norm.
+ * @details Computes 1 / sqrt(x^2 + y^2 + z^2) for each 3-axis vector using the hardware square root accelerator
+ *          followed by three Newton-Raphson iterations of the reciprocal (relative error of the reciprocal below 1.5e-7).
+ *          The result for a null vector is not meaningful.
+ * @param[in] src Pointer to the input vector, containing block_size interleaved x, y, z triplets
+ * @param[out] dst Pointer to the output vector, containing block_size values
+ * @param[in] block_size Number of 3-axis vectors
+ */
+void ispu_inv_norm3_f32(const float *src, float *dst, uint32_t block_size);
+
 /**
  * @brief Floating-point vector element-wise mutiplication.
  * @param[in] src0 Pointer to the first input vector
@@ -68,6 +79,40 @@ void ispu_mult_f32(const float *src0, const float *src1, float *dst, uint32_t bl
  */
 void ispu_negate_f32(const float *src, float *dst, uint32_t block_size);
 
+/**
+ * @brief Floating-point 3-axis vector norm.
+ * @details Computes sqrt(x^2 + y^2 + z^2) for each 3-axis vector, overlapping the latency of the hardware square root accelerator
+ *          with the computation of the next vector.
+ * @param[in] src Pointer to the input vector, containing block_size interleaved x, y, z triplets
+ * @param[out] dst Pointer to the output vector, containing block_size values
+ * @param[in] block_size Number of 3-axis vectors
+ */
+void ispu_norm3_f32(const float *src, float *dst, uint32_t block_size);
+
+/**
+ * @brief Floating-point 3-element vector normalization.
+ * @details Divides each 3-element vector by its norm, obtained with the hardware square root accelerator,
+ *          without any division: the reciprocal of the norm is refined with three Newton-Raphson iterations.
+ *          Each output element has an absolute error below 3e-7 with respect to the exact unit vector.
+ *          Vectors with norm below 1e-18 are scaled by 1e18 instead, so that a null vector results in a null output.
+ * @param[in] src Pointer to the input vector, containing block_size interleaved x, y, z triplets
+ * @param[out] dst Pointer to the output vector, containing block_size interleaved x, y, z triplets (can be equal to src)
+ * @param[in] block_size Number of 3-element vectors
+ */
+void ispu_normalize3_f32(const float *src, float *dst, uint32_t block_size);
+
+/**
+ * @brief Floating-point 4-element vector normalization.
+ * @details Divides each 4-element vector by its norm, obtained with the hardware square root accelerator,
+ *          without any division: the reciprocal of the norm is refined with three Newton-Raphson iterations.
+ *          Each output element has an absolute error below 3e-7 with respect to the exact unit vector.
+ *          Vectors with norm below 1e-18 are scaled by 1e18 instead, so that a null vector results in a null output.
+ * @param[in] src Pointer to the input vector, containing block_size interleaved x, y, z, w quadruplets (e.g. quaternions)
+ * @param[out] dst Pointer to the output vector, containing block_size interleaved x, y, z, w quadruplets (e.g. quaternions) (can be equal to src)
+ * @param[in] block_size Number of 4-element vectors
+ */
+void ispu_normalize4_f32(const float *src, float *dst, uint32_t block_size);
+
 /**
  * @brief Floating-point vector offset addition.
  * @param[in] src Pointer to the input vector
@@ -378,6 +423,19 @@ void ispu_absmin_no_idx_f32(const float *src, float *res, uint32_t block_size);
  */
 void ispu_accumulate_f32(const float *src, float *res, uint32_t block_size);
 
+/**
+ * @brief Floating-point vector level crossings count.
+ * @details Counts the number of times the signal crosses the specified level, that is the number of consecutive samples lying on opposite sides of it.
+ *          With level = 0 the zero-crossing rate can be obtained as res / (block_size - 1).
+ *          The stride allows processing one axis of interleaved data (for example, stride = 3 with the x, y, z samples stored contiguously).
+ * @param[in] src Pointer to the first sample
+ * @param[in] level Crossing level
+ * @param[out] res Pointer to the result value
+ * @param[in] block_size Number of samples to be processed
+ * @param[in] stride Distance between two consecutive samples in the input vector (1 for contiguous samples)
+ */
+void ispu_level_crossings_f32(const float *src, float level, uint32_t *res, uint32_t block_size, uint32_t stride);
+
 /**
  * @brief Floating-point vector maximum.
  * @param[in] src Pointer to the input vector
@@ -403,6 +461,16 @@ void ispu_max_no_idx_f32(const float *src, float *res, uint32_t block_size);
  */
 void ispu_mean_f32(const float *src, float *res, uint32_t block_size);
 
+/**
+ * @brief Floating-point vector mean crossings count.
+ * @details Computes the mean of the signal and then counts the number of times the signal crosses it (see ispu_level_crossings_f32).
+ * @param[in] src Pointer to the first sample
+ * @param[out] res Pointer to the result value
+ * @param[in] block_size Number of samples to be processed
+ * @param[in] stride Distance between two consecutive samples in the input vector (1 for contiguous samples)
+ */
+void ispu_mean_crossings_f32(const float *src, uint32_t *res, uint32_t block_size, uint32_t stride);
+
 /**
  * @brief Floating-point vector minimum.
  * @param[in] src Pointer to the input vector
@@ -420,6 +488,20 @@ void ispu_min_f32(const float *src, float *res, uint32_t *idx, uint32_t block_si
  */
 void ispu_min_no_idx_f32(const float *src, float *res, uint32_t block_size);
 
+/**
+ * @brief Floating-point vector peak count with hysteresis.
+ * @details A peak is counted every time the signal reaches or exceeds the high threshold after having been below the low threshold,
+ *          so that noise around a single threshold does not result in multiple peaks.
+ *          The count starts disarmed, i.e. a peak already in progress at the first sample is not counted.
+ * @param[in] src Pointer to the first sample
+ * @param[in] low Low threshold (re-arms the detection)
+ * @param[in] high High threshold (must be greater than low)
+ * @param[out] res Pointer to the result value
+ * @param[in] block_size Number of samples to be processed
+ * @param[in] stride Distance between two consecutive samples in the input vector (1 for contiguous samples)
+ */
+void ispu_peak_count_f32(const float *src, float low, float high, uint32_t *res, uint32_t block_size, uint32_t stride);
+
 /**
  * @brief Floating-point vector power (sum of the squared values).
  * @param[in] src Pointer to the input vector
@@ -547,6 +629,52 @@ int ispu_hilbert_init_f32(struct ispu_hilbert_instance_f32 *inst, uint16_t hilbe
  */
 void ispu_hilbert_f32(struct ispu_hilbert_instance_f32 *inst, float *src, float *dst);
 
+/**
+ * @brief Floating-point real cepstrum instance structure.
+ */
+struct ispu_cepstrum_instance_f32 {
+	struct ispu_rfft_instance_f32 rfft_inst; /**< Internal RFFT instance */
+	uint16_t cepstrum_len; /**< Length of the cepstrum. */
+};
+
+/**
+ * @brief Floating-point real cepstrum initialization function.
+ * @param[in] inst Pointer to the instance structure
+ * @param[in] cepstrum_len Length of the cepstrum (32, 64, 128, 256, 512, 1024, or 2048)
+ * @return 0 on success or -1 on failure
+ */
+int ispu_cepstrum_init_f32(struct ispu_cepstrum_instance_f32 *inst, uint16_t cepstrum_len);
+
+/**
+ * @brief Floating-point real cepstrum processing function.
+ * @details The output is the real cepstrum of the input signal, computed as the inverse RFFT of the logarithm of the magnitude spectrum.
+ *          The output element of index q (quefrency) corresponds to a period of q samples in the input signal,
+ *          so that a family of harmonics or sidebands evenly spaced by f Hz results in a peak at q = ODR / f.
+ *          Only the first cepstrum_len / 2 elements are meaningful, the second half being symmetric.
+ * @param[in] inst Pointer to the instance structure
+ * @param[in,out] data Pointer to the input/output data.
+ *                     It must be aligned as follows:
+ *                      - cepstrum_len = 32 requires alignment to 128 bytes
+ *                      - cepstrum_len = 64 requires alignment to 256 bytes
+ *                      - cepstrum_len = 128 requires alignment to 512 bytes
+ *                      - cepstrum_len = 256 requires alignment to 1024 bytes
+ *                      - cepstrum_len = 512 requires alignment to 2048 bytes
+ *                      - cepstrum_len = 1024 requires alignment to 4096 bytes
+ *                      - cepstrum_len = 2048 requires alignment to 8192 bytes
+ */
+void ispu_cepstrum_f32(struct ispu_cepstrum_instance_f32 *inst, float *data);
+
+/**
+ * @brief Floating-point cepstrum peak (rahmonic) search in a quefrency range.
+ * @details The low quefrencies, describing the spectral envelope, should be excluded by properly setting q_min.
+ * @param[in] src Pointer to the cepstrum computed by ispu_cepstrum_f32
+ * @param[in] q_min First quefrency of the search range (in samples)
+ * @param[in] q_max Last quefrency of the search range (in samples, included, must be greater or equal to q_min)
+ * @param[out] res Pointer to the peak value
+ * @param[out] idx Pointer to the quefrency of the peak (in samples)
+ */
+void ispu_cepstrum_peak_f32(const float *src, uint16_t q_min, uint16_t q_max, float *res, uint32_t *idx);
+
 /** @} */
 
 /**
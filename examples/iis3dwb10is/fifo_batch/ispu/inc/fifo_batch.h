@@ -0,0 +1,39 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#ifndef FIFO_BATCH_H
+#define FIFO_BATCH_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// A record is written to the FIFO as consecutive FIFO words of 9 data bytes (the last one padded with zeros). The tag
+// of each word holds the type of the record in bits [4:0] and the number of words of the record following the word in
+// bits [7:5], so that the host can reassemble the records and detect the words lost when the FIFO overflows. A record
+// of one word has the type as tag, as the entries written by the fifo_write example.
+#define FIFO_BATCH_WORD_LEN 9u
+#define FIFO_BATCH_MAX_WORDS 8u
+#define FIFO_BATCH_MAX_LEN (FIFO_BATCH_WORD_LEN * FIFO_BATCH_MAX_WORDS)
+#define FIFO_BATCH_MAX_TYPE 31u
+
+#define FIFO_BATCH_TAG(type, left) ((uint8_t)(((left) << 5) | (type)))
+#define FIFO_BATCH_TAG_TYPE(tag) ((uint8_t)(tag) & 0x1Fu)
+#define FIFO_BATCH_TAG_LEFT(tag) ((uint8_t)(tag) >> 5)
+
+// writes a record of len bytes (up to FIFO_BATCH_MAX_LEN, 0 for an event without data) with the specified type (up to
+// FIFO_BATCH_MAX_TYPE), waiting for each FIFO word to be written; the ISPU_DOUT_11 to ISPU_DOUT_15 registers are used
+// to pass the words to the FIFO and must not hold other outputs
+bool fifo_batch_write(uint8_t type, const void *data, uint8_t len);
+
+#endif
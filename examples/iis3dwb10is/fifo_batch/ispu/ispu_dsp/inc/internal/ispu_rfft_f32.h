@@ -0,0 +1,27 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#ifndef ISPU_RFFT_F32_H
+#define ISPU_RFFT_F32_H
+
+extern float twiddle_table32[];
+extern float twiddle_table64[];
+extern float twiddle_table128[];
+extern float twiddle_table256[];
+extern float twiddle_table512[];
+extern float twiddle_table1024[];
+extern float twiddle_table2048[];
+
+#endif
+
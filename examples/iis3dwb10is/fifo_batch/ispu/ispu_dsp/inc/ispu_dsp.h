@@ -0,0 +1,703 @@
+/**
+  ******************************************************************************
+  * @file
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#ifndef ISPU_DSP_H
+#define ISPU_DSP_H
+
+#include <stdint.h>
+
+/**
+ * @defgroup basic_math Basic math
+ * @details This group provides basic math on vectors.
+ * @{
+ */
+
+/**
+ * @brief Floating-point vector absolute value.
+ * @param[in] src Pointer to the input vector
+ * @param[out] dst Pointer to the output vector
+ * @param[in] block_size Number of samples in each vector
+ */
+void ispu_abs_f32(const float *src, float *dst, uint32_t block_size);
+
+/**
+ * @brief Floating-point vector addition.
+ * @param[in] src0 Pointer to the first input vector
+ * @param[in] src1 Pointer to the second input vector
+ * @param[out] dst Pointer to the output vector
+ * @param[in] block_size Number of samples in each vector
+ */
+void ispu_add_f32(const float *src0, const float *src1, float *dst, uint32_t block_size);
+
+/**
+ * @brief Floating-point vector clipping.
+ * @param[in] src Pointer to the input vector
+ * @param[out] dst Pointer to the output vector
+ * @param[in] low Lower bound value
+ * @param[in] high Higher bound value
+ * @param[in] block_size Number of samples in each vector
+ */
+void ispu_clip_f32(const float *src, float *dst, float low, float high, uint32_t block_size);
+
+/**
+ * @brief Floating-point 3-axis vector inverse norm.
+ * @details Computes 1 / sqrt(x^2 + y^2 + z^2) for each 3-axis vector using the hardware square root accelerator
+ *          followed by three Newton-Raphson iterations of the reciprocal (relative error of the reciprocal below 1.5e-7).
+ *          The result for a null vector is not meaningful.
+ * @param[in] src Pointer to the input vector, containing block_size interleaved x, y, z triplets
+ * @param[out] dst Pointer to the output vector, containing block_size values
+ * @param[in] block_size Number of 3-axis vectors
+ */
+void ispu_inv_norm3_f32(const float *src, float *dst, uint32_t block_size);
+
+/**
+ * @brief Floating-point vector element-wise mutiplication.
+ * @param[in] src0 Pointer to the first input vector
+ * @param[in] src1 Pointer to the second input vector
+ * @param[out] dst Pointer to the output vector
+ * @param[in] block_size Number of samples in each vector
+ */
+void ispu_mult_f32(const float *src0, const float *src1, float *dst, uint32_t block_size);
+
+/**
+ * @brief Floating-point vector negation.
+ * @param[in] src Pointer to the input vector
+ * @param[out] dst Pointer to the output vector
+ * @param[in] block_size Number of samples in each vector
+ */
+void ispu_negate_f32(const float *src, float *dst, uint32_t block_size);
+
+/**
+ * @brief Floating-point 3-axis vector norm.
+ * @details Computes sqrt(x^2 + y^2 + z^2) for each 3-axis vector, overlapping the latency of the hardware square root accelerator
+ *          with the computation of the next vector.
+ * @param[in] src Pointer to the input vector, containing block_size interleaved x, y, z triplets
+ * @param[out] dst Pointer to the output vector, containing block_size values
+ * @param[in] block_size Number of 3-axis vectors
+ */
+void ispu_norm3_f32(const float *src, float *dst, uint32_t block_size);
+
+/**
+ * @brief Floating-point 3-element vector normalization.
+ * @details Divides each 3-element vector by its norm, obtained with the hardware square root accelerator,
+ *          without any division: the reciprocal of the norm is refined with three Newton-Raphson iterations.
+ *          Each output element has an absolute error below 3e-7 with respect to the exact unit vector.
+ *          Vectors with norm below 1e-18 are scaled by 1e18 instead, so that a null vector results in a null output.
+ * @param[in] src Pointer to the input vector, containing block_size interleaved x, y, z triplets
+ * @param[out] dst Pointer to the output vector, containing block_size interleaved x, y, z triplets (can be equal to src)
+ * @param[in] block_size Number of 3-element vectors
+ */
+void ispu_normalize3_f32(const float *src, float *dst, uint32_t block_size);
+
+/**
+ * @brief Floating-point 4-element vector normalization.
+ * @details Divides each 4-element vector by its norm, obtained with the hardware square root accelerator,
+ *          without any division: the reciprocal of the norm is refined with three Newton-Raphson iterations.
+ *          Each output element has an absolute error below 3e-7 with respect to the exact unit vector.
+ *          Vectors with norm below 1e-18 are scaled by 1e18 instead, so that a null vector results in a null output.
+ * @param[in] src Pointer to the input vector, containing block_size interleaved x, y, z, w quadruplets (e.g. quaternions)
+ * @param[out] dst Pointer to the output vector, containing block_size interleaved x, y, z, w quadruplets (e.g. quaternions) (can be equal to src)
+ * @param[in] block_size Number of 4-element vectors
+ */
+void ispu_normalize4_f32(const float *src, float *dst, uint32_t block_size);
+
+/**
+ * @brief Floating-point vector offset addition.
+ * @param[in] src Pointer to the input vector
+ * @param[in] offset Offset value
+ * @param[out] dst Pointer to the output vector
+ * @param[in] block_size Number of samples in each vector
+ */
+void ispu_offset_f32(const float *src, float offset, float *dst, uint32_t block_size);
+
+/**
+ * @brief Floating-point vector scalar multiplication.
+ * @param[in] src Pointer to the input vector
+ * @param[in] scale Scalar value
+ * @param[out] dst Pointer to the output vector
+ * @param[in] block_size Number of samples in each vector
+ */
+void ispu_scale_f32(const float *src, float scale, float *dst, uint32_t block_size);
+
+/**
+ * @brief Floating-point vector subtraction.
+ * @param[in] src0 Pointer to the first input vector
+ * @param[in] src1 Pointer to the second input vector
+ * @param[out] dst Pointer to the output vector
+ * @param[in] block_size Number of samples in each vector
+ */
+void ispu_sub_f32(const float *src0, const float *src1, float *dst, uint32_t block_size);
+
+/**
+ * @brief Floating-point vector element-wise squaring.
+ * @param[in] src Pointer to the input vector
+ * @param[out] dst Pointer to the output vector
+ * @param[in] block_size Number of samples in each vector
+ */
+void ispu_square_f32(const float *src, float *dst, uint32_t block_size);
+
+/**
+ * @brief Floating-point vector square root.
+ * @param[in] src Pointer to the input vector
+ * @param[out] dst Pointer to the output vector
+ * @param[in] block_size Number of samples in each vector
+ */
+void ispu_vsqrt_f32(const float *src, float *dst, uint32_t block_size);
+
+/** @} */
+
+/**
+ * @defgroup complex_math Complex math
+ * @details This group provides complex math on vectors.
+ *          Each complex value of the vectors is composed by two floating-point values, the first one representing the real part and the second one representing the
+ *          imaginary part.
+ * @{
+ */
+
+/**
+ * @brief Floating-point complex vector element-wise magnitude.
+ * @param[in] src Pointer to the input complex vector
+ * @param[out] dst Pointer to the output real vector
+ * @param[in] block_size Number of samples in each vector
+ */
+void ispu_cmplx_mag_f32(const float *src, float *dst, uint32_t block_size);
+
+/**
+ * @brief Floating-point complex vector element-wise squared magnitude.
+ * @param[in] src Pointer to the input complex vector
+ * @param[out] dst Pointer to the output real vector
+ * @param[in] block_size Number of samples in each vector
+ */
+void ispu_cmplx_mag_squared_f32(const float *src, float *dst, uint32_t block_size);
+
+/** @} */
+
+/**
+ * @defgroup filtering Filtering
+ * @details This group provides digital filters.
+ * @{
+ */
+
+/**
+ * @brief Floating-point biquad cascade filter (direct form I) instance structure.
+ */
+struct ispu_biquad_casd_df1_inst_f32 {
+	uint8_t num_stages; /**< Number of biquad stages. */
+	float *state; /**< Pointer to the state array (length must be num_stages * 4). */
+	const float *coeffs; /**< Pointer to the coefficients array (length must num_stages * 5).
+	                          The array must contain, in order, b0, b1, b2, -a1, -a2 for each biquad stage. */
+};
+
+/**
+ * @brief Floating-point biquad cascade filter (direct form I) initialization function.
+ * @param[in] inst Pointer to the instance structure
+ * @param[in] num_stages Number of biquad stages
+ * @param[in] coeffs Pointer to the coefficients array
+ * @param[in] state Pointer to the state array
+ */
+void ispu_biquad_cascade_df1_init_f32(struct ispu_biquad_casd_df1_inst_f32 *inst, uint8_t num_stages, const float *coeffs, float *state);
+
+/**
+ * @brief Floating-point biquad cascade filter (direct form I) processing function.
+ * @param[in] inst Pointer to the instance structure
+ * @param[in] src Pointer to the input vector
+ * @param[out] dst Pointer to the output vector
+ * @param[in] block_size Number of samples to process
+ */
+void ispu_biquad_cascade_df1_f32(const struct ispu_biquad_casd_df1_inst_f32 *inst, const float *src, float *dst, uint32_t block_size);
+
+/**
+ * @brief Floating-point biquad cascade filter (direct form II transposed) instance structure.
+ */
+struct ispu_biquad_casd_df2T_inst_f32 {
+	uint8_t num_stages; /**< Number of biquad stages. */
+	float *state; /**< Pointer to the state array (length must be num_stages * 2). */
+	const float *coeffs; /**< Pointer to the coefficients array (length must num_stages * 5).
+	                          The array must contain, in order, b0, b1, b2, -a1, -a2 for each biquad stage. */
+};
+
+/**
+ * @brief Floating-point biquad cascade filter (direct form II transposed) initialization function.
+ * @param[in] inst Pointer to the instance structure
+ * @param[in] num_stages Number of biquad stages
+ * @param[in] coeffs Pointer to the coefficients array
+ * @param[in] state Pointer to the state array
+ */
+void ispu_biquad_cascade_df2T_init_f32(struct ispu_biquad_casd_df2T_inst_f32 *inst, uint8_t num_stages, const float *coeffs, float *state);
+
+/**
+ * @brief Floating-point biquad cascade filter (direct form II transposed) processing function.
+ * @param[in] inst Pointer to the instance structure
+ * @param[in] src Pointer to the input vector
+ * @param[out] dst Pointer to the output vector
+ * @param[in] block_size Number of samples to process
+ */
+void ispu_biquad_cascade_df2T_f32(const struct ispu_biquad_casd_df2T_inst_f32 *inst, const float *src, float *dst, uint32_t block_size);
+
+/**
+ * @brief Floating-point FIR filter instance structure.
+ */
+struct ispu_fir_instance_f32 {
+	uint16_t num_taps; /**< Number of taps/coefficients. */
+	float *state; /**< Pointer to the state array (length must be num_taps + block_size - 1). */
+	const float *coeffs; /**< Pointer to the coefficients array (length must be num_taps). */
+	void (*impl)(const struct ispu_fir_instance_f32 *inst, const float *src, float *dst, uint32_t block_size); /**< Pointer to the implementation function. */
+};
+
+/**
+ * @brief Floating-point FIR filter initialization function.
+ * @param[in] inst Pointer to the instance structure
+ * @param[in] num_taps Number of taps/coefficients
+ * @param[in] coeffs Pointer to the coefficients array
+ * @param[in] state Pointer to the state array
+ * @param[in] block_size Maximum number of samples to process at each call
+ */
+void ispu_fir_init_f32(struct ispu_fir_instance_f32 *inst, uint16_t num_taps, const float *coeffs, float *state, uint32_t block_size);
+
+/**
+ * @brief Floating-point FIR filter processing function.
+ * @param[in] inst Pointer to the instance structure
+ * @param[in] src Pointer to the input vector
+ * @param[in] dst Pointer to the output vector
+ * @param[in] block_size Number of samples to process
+ */
+void ispu_fir_f32(const struct ispu_fir_instance_f32 *inst, const float *src, float *dst, uint32_t block_size);
+
+/**
+ * @brief Floating-point FIR filter (optimized) instance structure.
+ * @details The FIR filter (optimized) internally uses the hardware circular buffer accelerator. The accelerator registers must be saved and restored by the user if the
+ *          execution of the filter is interrupted and the accelerator is needed for other purposes during the interruption.
+ */
+struct ispu_fir_instance_f32_opt {
+	uint16_t num_taps; /**< Number of taps/coefficients (must be lower than or equal to 1024). */
+	float *state; /**< Pointer to the state array (must be aligned to 4096 bytes and its length must be num_taps). */
+	float *state_curr; /**< Pointer to the current element of the state array. */
+	const float *coeffs; /**< Pointer to the coefficients array (length must be num_taps). */
+	void (*impl)(const struct ispu_fir_instance_f32_opt *inst, const float *src, float *dst, uint32_t block_size); /**< Pointer to the implementation function. */
+};
+
+/**
+ * @brief Floating-point FIR filter (optimized) initialization function.
+ * @param[in] inst Pointer to the instance structure
+ * @param[in] num_taps Number of taps/coefficients
+ * @param[in] coeffs Pointer to the coefficients array
+ * @param[in] state Pointer to the state array
+ * @return 0 on success or -1 on failure
+ */
+int ispu_fir_init_f32_opt(struct ispu_fir_instance_f32_opt *inst, uint16_t num_taps, const float *coeffs, float *state);
+
+/**
+ * @brief Floating-point FIR filter (optimized) processing function.
+ * @param[in] inst Pointer to the instance structure
+ * @param[in] src Pointer to the input vector
+ * @param[in] dst Pointer to the output vector
+ * @param[in] block_size Number of samples to process
+ */
+void ispu_fir_f32_opt(const struct ispu_fir_instance_f32_opt *inst, const float *src, float *dst, uint32_t block_size);
+
+/**
+ * @brief Floating-point FIR decimator instance structure.
+ */
+struct ispu_fir_decimate_instance_f32 {
+	uint8_t dec; /**< Decimation factor (must be an integer divisor of block_size). */
+	uint16_t num_taps; /**< Number of taps/coefficients. */
+	float *state; /**< Pointer to the state array (length must be num_taps + block_size - 1). */
+	const float *coeffs; /**< Pointer to the coefficients array (length must be num_taps). */
+	void (*impl)(const struct ispu_fir_decimate_instance_f32 *inst, const float *src, float *dst, uint32_t block_size); /**< Pointer to the implementation function. */
+};
+
+/**
+ * @brief Floating-point FIR decimator initialization function.
+ * @param[in] inst Pointer to the instance structure
+ * @param[in] num_taps Number of taps/coefficients
+ * @param[in] dec Decimation factor
+ * @param[in] coeffs Pointer to the coefficients array
+ * @param[in] state Pointer to the state array
+ * @param[in] block_size Number of samples to process at each call
+ */
+int ispu_fir_decimate_init_f32(struct ispu_fir_decimate_instance_f32 *inst, uint16_t num_taps, uint8_t dec, const float *coeffs, float *state, uint32_t block_size);
+
+/**
+ * @brief Floating-point FIR decimator processing function.
+ * @param[in] inst Pointer to the instance structure
+ * @param[in] src Pointer to the input vector
+ * @param[in] dst Pointer to the output vector
+ * @param[in] block_size Number of samples to process
+ */
+void ispu_fir_decimate_f32(const struct ispu_fir_decimate_instance_f32 *inst, const float *src, float *dst, uint32_t block_size);
+
+/**
+ * @brief Floating-point FIR decimator (optimized) instance structure.
+ * @details The FIR decimator (optimized) internally uses the hardware circular buffer accelerator. The accelerator registers must be saved and restored by the user if the
+ *          execution of the filter is interrupted and the accelerator is needed for other purposes during the interruption.
+ */
+struct ispu_fir_decimate_instance_f32_opt {
+	uint8_t dec; /**< Decimation factor (must be an integer divisor of block_size). */
+	uint16_t num_taps; /**< Number of taps/coefficients (must be lower than or equal to 1024). */
+	float *state; /**< Pointer to the state array (must be aligned to 4096 bytes and its length must be num_taps). */
+	float *state_curr; /**< Pointer to the current element of the state array. */
+	const float *coeffs; /**< Pointer to the coefficients array (length must be num_taps). */
+	void (*impl)(const struct ispu_fir_decimate_instance_f32_opt *inst, const float *src, float *dst, uint32_t block_size); /**< Pointer to the implementation function. */
+};
+
+/**
+ * @brief Floating-point FIR decimator (optimized) initialization function.
+ * @param[in] inst Pointer to the instance structure
+ * @param[in] num_taps Number of taps/coefficients
+ * @param[in] dec Decimation factor
+ * @param[in] coeffs Pointer to the coefficients array
+ * @param[in] state Pointer to the state array
+ * @param[in] block_size Number of samples to process at each call
+ * @return 0 on success or -1 on failure
+ */
+int ispu_fir_decimate_init_f32_opt(struct ispu_fir_decimate_instance_f32_opt *inst, uint16_t num_taps, uint8_t dec, const float *coeffs, float *state, uint32_t block_size);
+
+/**
+ * @brief Floating-point FIR decimator (optimized) processing function.
+ * @param[in] inst Pointer to the instance structure
+ * @param[in] src Pointer to the input vector
+ * @param[in] dst Pointer to the output vector
+ * @param[in] block_size Number of samples to process
+ */
+void ispu_fir_decimate_f32_opt(const struct ispu_fir_decimate_instance_f32_opt *inst, const float *src, float *dst, uint32_t block_size);
+
+/** @} */
+
+/**
+ * @defgroup statistics Statistics
+ * @details This group provides statistical features.
+ * @{
+ */
+
+/**
+ * @brief Floating-point vector maximum of the asbolute values.
+ * @param[in] src Pointer to the input vector
+ * @param[out] res Pointer to the result value
+ * @param[out] idx Index of the result
+ * @param[in] block_size Number of samples in the input vector
+ */
+void ispu_absmax_f32(const float *src, float *res, uint32_t *idx, uint32_t block_size);
+
+/**
+ * @brief Floating-point vector maximum of the asbolute values.
+ * @param[in] src Pointer to the input vector
+ * @param[out] res Pointer to the result value
+ * @param[in] block_size Number of samples in the input vector
+ */
+void ispu_absmax_no_idx_f32(const float *src, float *res, uint32_t block_size);
+
+/**
+ * @brief Floating-point vector minimum of the asbolute values.
+ * @param[in] src Pointer to the input vector
+ * @param[out] res Pointer to the result value
+ * @param[out] idx Index of the result
+ * @param[in] block_size Number of samples in the input vector
+ */
+void ispu_absmin_f32(const float *src, float *res, uint32_t *idx, uint32_t block_size);
+
+/**
+ * @brief Floating-point vector minimum of the asbolute values.
+ * @param[in] src Pointer to the input vector
+ * @param[out] res Pointer to the result value
+ * @param[in] block_size Number of samples in the input vector
+ */
+void ispu_absmin_no_idx_f32(const float *src, float *res, uint32_t block_size);
+
+/**
+ * @brief Floating-point vector accumulation.
+ * @param[in] src Pointer to the input vector
+ * @param[out] res Pointer to the result value
+ * @param[in] block_size Number of samples in the input vector
+ */
+void ispu_accumulate_f32(const float *src, float *res, uint32_t block_size);
+
+/**
+ * @brief Floating-point vector level crossings count.
+ * @details Counts the number of times the signal crosses the specified level, that is the number of consecutive samples lying on opposite sides of it.
+ *          With level = 0 the zero-crossing rate can be obtained as res / (block_size - 1).
+ *          The stride allows processing one axis of interleaved data (for example, stride = 3 with the x, y, z samples stored contiguously).
+ * @param[in] src Pointer to the first sample
+ * @param[in] level Crossing level
+ * @param[out] res Pointer to the result value
+ * @param[in] block_size Number of samples to be processed
+ * @param[in] stride Distance between two consecutive samples in the input vector (1 for contiguous samples)
+ */
+void ispu_level_crossings_f32(const float *src, float level, uint32_t *res, uint32_t block_size, uint32_t stride);
+
+/**
+ * @brief Floating-point vector maximum.
+ * @param[in] src Pointer to the input vector
+ * @param[out] res Pointer to the result value
+ * @param[out] idx Index of the result
+ * @param[in] block_size Number of samples in the input vector
+ */
+void ispu_max_f32(const float *src, float *res, uint32_t *idx, uint32_t block_size);
+
+/**
+ * @brief Floating-point vector maximum.
+ * @param[in] src Pointer to the input vector
+ * @param[out] res Pointer to the result value
+ * @param[in] block_size Number of samples in the input vector
+ */
+void ispu_max_no_idx_f32(const float *src, float *res, uint32_t block_size);
+
+/**
+ * @brief Floating-point vector mean.
+ * @param[in] src Pointer to the input vector
+ * @param[out] res Pointer to the result value
+ * @param[in] block_size Number of samples in the input vector
+ */
+void ispu_mean_f32(const float *src, float *res, uint32_t block_size);
+
+/**
+ * @brief Floating-point vector mean crossings count.
+ * @details Computes the mean of the signal and then counts the number of times the signal crosses it (see ispu_level_crossings_f32).
+ * @param[in] src Pointer to the first sample
+ * @param[out] res Pointer to the result value
+ * @param[in] block_size Number of samples to be processed
+ * @param[in] stride Distance between two consecutive samples in the input vector (1 for contiguous samples)
+ */
+void ispu_mean_crossings_f32(const float *src, uint32_t *res, uint32_t block_size, uint32_t stride);
+
+/**
+ * @brief Floating-point vector minimum.
+ * @param[in] src Pointer to the input vector
+ * @param[out] res Pointer to the result value
+ * @param[out] idx Index of the result
+ * @param[in] block_size Number of samples in the input vector
+ */
+void ispu_min_f32(const float *src, float *res, uint32_t *idx, uint32_t block_size);
+
+/**
+ * @brief Floating-point vector minimum.
+ * @param[in] src Pointer to the input vector
+ * @param[out] res Pointer to the result value
+ * @param[in] block_size Number of samples in the input vector
+ */
+void ispu_min_no_idx_f32(const float *src, float *res, uint32_t block_size);
+
+/**
+ * @brief Floating-point vector peak count with hysteresis.
+ * @details A peak is counted every time the signal reaches or exceeds the high threshold after having been below the low threshold,
+ *          so that noise around a single threshold does not result in multiple peaks.
+ *          The count starts disarmed, i.e. a peak already in progress at the first sample is not counted.
+ * @param[in] src Pointer to the first sample
+ * @param[in] low Low threshold (re-arms the detection)
+ * @param[in] high High threshold (must be greater than low)
+ * @param[out] res Pointer to the result value
+ * @param[in] block_size Number of samples to be processed
+ * @param[in] stride Distance between two consecutive samples in the input vector (1 for contiguous samples)
+ */
+void ispu_peak_count_f32(const float *src, float low, float high, uint32_t *res, uint32_t block_size, uint32_t stride);
+
+/**
+ * @brief Floating-point vector power (sum of the squared values).
+ * @param[in] src Pointer to the input vector
+ * @param[out] res Pointer to the result value
+ * @param[in] block_size Number of samples in the input vector
+ */
+void ispu_power_f32(const float *src, float *res, uint32_t block_size);
+
+/**
+ * @brief Floating-point vector RMS (root mean square).
+ * @param[in] src Pointer to the input vector
+ * @param[out] res Pointer to the result value
+ * @param[in] block_size Number of samples in the input vector
+ */
+void ispu_rms_f32(const float *src, float *res, uint32_t block_size);
+
+/**
+ * @brief Floating-point vector standard deviation.
+ * @param[in] src Pointer to the input vector
+ * @param[out] res Pointer to the result value
+ * @param[in] block_size Number of samples in the input vector
+ */
+void ispu_std_f32(const float *src, float *res, uint32_t block_size);
+
+/**
+ * @brief Floating-point vector variance.
+ * @param[in] src Pointer to the input vector
+ * @param[out] res Pointer to the result value
+ * @param[in] block_size Number of samples in the input vector
+ */
+void ispu_var_f32(const float *src, float *res, uint32_t block_size);
+
+/** @} */
+
+/**
+ * @defgroup transform Transform
+ * @details This group provides tranforms.
+ * @{
+ */
+
+/**
+ * @brief Floating-point RFFT (real fast Fourier transform) instance structure.
+ */
+struct ispu_rfft_instance_f32 {
+	float *twiddle_table; /**< Pointer to the twiddle table. */
+	uint16_t fft_len; /**< Length of the FFT. */
+	uint8_t fft_n_elem_bra; /**< Length of the FFT coded for ISPU_FFT_N_ELEM_BRA register. */
+};
+
+/**
+ * @brief Floating-point RFFT (real fast Fourier transform) initialization function.
+ * @param[in] inst Pointer to the instance structure
+ * @param[in] fft_len Length of the FFT (32, 64, 128, 256, 512, 1024, or 2048)
+ * @return 0 on success or -1 on failure
+ */
+int ispu_rfft_init_f32(struct ispu_rfft_instance_f32 *inst, uint16_t fft_len);
+
+/**
+ * @brief Floating-point RFFT (real fast Fourier transform) processing function.
+ * @details The output is the first half of the spectrum represented as complex numbers.
+ *          Each complex number is composed by two floating-point values, the first one representing the real part and the second one representing the imaginary part.
+ *          The first complex number in the output contains the DC bin in the real part and the Nyquist bin in the imaginary part.
+ * @param[in] inst Pointer to the instance structure
+ * @param[in,out] data Pointer to the input/output data.
+ *                     It must be aligned as follows:
+ *                      - fft_len = 32 requires alignment to 128 bytes
+ *                      - fft_len = 64 requires alignment to 256 bytes
+ *                      - fft_len = 128 requires alignment to 512 bytes
+ *                      - fft_len = 256 requires alignment to 1024 bytes
+ *                      - fft_len = 512 requires alignment to 2048 bytes
+ *                      - fft_len = 1024 requires alignment to 4096 bytes
+ *                      - fft_len = 2048 requires alignment to 8192 bytes
+ */
+void ispu_rfft_f32(struct ispu_rfft_instance_f32 *inst, float *data);
+
+/**
+ * @brief Floating-point IRFFT (inverse real fast Fourier transform) processing function.
+ * @details The output is a real signal corresponding to the inverse of the input half spectrum.
+ *          The input must be in the same format as the output of the ispu_rfft_f32 function.
+ * @param[in] inst Pointer to the instance structure
+ * @param[in,out] data Pointer to the input/output data.
+ *                     It must be aligned as follows:
+ *                      - fft_len = 32 requires alignment to 128 bytes
+ *                      - fft_len = 64 requires alignment to 256 bytes
+ *                      - fft_len = 128 requires alignment to 512 bytes
+ *                      - fft_len = 256 requires alignment to 1024 bytes
+ *                      - fft_len = 512 requires alignment to 2048 bytes
+ *                      - fft_len = 1024 requires alignment to 4096 bytes
+ *                      - fft_len = 2048 requires alignment to 8192 bytes
+ */
+void ispu_irfft_f32(struct ispu_rfft_instance_f32 *inst, float *data);
+
+/**
+ * @brief Floating-point real Hilbert transform instance structure.
+ */
+struct ispu_hilbert_instance_f32 {
+	struct ispu_rfft_instance_f32 rfft_inst; /**< Internal RFFT instance */
+	uint16_t hilbert_len; /**< Length of the Hilbert transform. */
+};
+
+/**
+ * @brief Floating-point real Hilbert transform initialization function.
+ * @param[in] inst Pointer to the instance structure
+ * @param[in] hilbert_len Length of the Hilbert transform (32, 64, 128, 256, 512, 1024, or 2048)
+ * @return 0 on success or -1 on failure
+ */
+int ispu_hilbert_init_f32(struct ispu_hilbert_instance_f32 *inst, uint16_t hilbert_len);
+
+/**
+ * @brief Floating-point real Hilbert transform processing function.
+ * @details The output is the Hilbert transform of the real input signal, resulting in hilbert_len complex numbers representing the analytic signal.
+ *          Each complex number is composed by two floating-point values, the first one representing the real part and the second one representing the imaginary part.
+ *          The real part represents the in-phase component while the imaginary part represents the quadrature component of the analytic signal.
+ * @param[in] inst Pointer to the instance structure
+ * @param[in] src Pointer to the input vector.
+ *                     It must be aligned as follows:
+ *                      - hilbert_len = 32 requires alignment to 128 bytes
+ *                      - hilbert_len = 64 requires alignment to 256 bytes
+ *                      - hilbert_len = 128 requires alignment to 512 bytes
+ *                      - hilbert_len = 256 requires alignment to 1024 bytes
+ *                      - hilbert_len = 512 requires alignment to 2048 bytes
+ *                      - hilbert_len = 1024 requires alignment to 4096 bytes
+ *                      - hilbert_len = 2048 requires alignment to 8192 bytes
+ * @param[out] dst Pointer to the output vector. Must be different from src pointer and must have double the size of src to accomodate for complex numbers.
+ */
+void ispu_hilbert_f32(struct ispu_hilbert_instance_f32 *inst, float *src, float *dst);
+
+/**
+ * @brief Floating-point real cepstrum instance structure.
+ */
+struct ispu_cepstrum_instance_f32 {
+	struct ispu_rfft_instance_f32 rfft_inst; /**< Internal RFFT instance */
+	uint16_t cepstrum_len; /**< Length of the cepstrum. */
+};
+
+/**
+ * @brief Floating-point real cepstrum initialization function.
+ * @param[in] inst Pointer to the instance structure
+ * @param[in] cepstrum_len Length of the cepstrum (32, 64, 128, 256, 512, 1024, or 2048)
+ * @return 0 on success or -1 on failure
+ */
+int ispu_cepstrum_init_f32(struct ispu_cepstrum_instance_f32 *inst, uint16_t cepstrum_len);
+
+/**
+ * @brief Floating-point real cepstrum processing function.
+ * @details The output is the real cepstrum of the input signal, computed as the inverse RFFT of the logarithm of the magnitude spectrum.
+ *          The output element of index q (quefrency) corresponds to a period of q samples in the input signal,
+ *          so that a family of harmonics or sidebands evenly spaced by f Hz results in a peak at q = ODR / f.
+ *          Only the first cepstrum_len / 2 elements are meaningful, the second half being symmetric.
+ * @param[in] inst Pointer to the instance structure
+ * @param[in,out] data Pointer to the input/output data.
+ *                     It must be aligned as follows:
+ *                      - cepstrum_len = 32 requires alignment to 128 bytes
+ *                      - cepstrum_len = 64 requires alignment to 256 bytes
+ *                      - cepstrum_len = 128 requires alignment to 512 bytes
+ *                      - cepstrum_len = 256 requires alignment to 1024 bytes
+ *                      - cepstrum_len = 512 requires alignment to 2048 bytes
+ *                      - cepstrum_len = 1024 requires alignment to 4096 bytes
+ *                      - cepstrum_len = 2048 requires alignment to 8192 bytes
+ */
+void ispu_cepstrum_f32(struct ispu_cepstrum_instance_f32 *inst, float *data);
+
+/**
+ * @brief Floating-point cepstrum peak (rahmonic) search in a quefrency range.
+ * @details The low quefrencies, describing the spectral envelope, should be excluded by properly setting q_min.
+ * @param[in] src Pointer to the cepstrum computed by ispu_cepstrum_f32
+ * @param[in] q_min First quefrency of the search range (in samples)
+ * @param[in] q_max Last quefrency of the search range (in samples, included, must be greater or equal to q_min)
+ * @param[out] res Pointer to the peak value
+ * @param[out] idx Pointer to the quefrency of the peak (in samples)
+ */
+void ispu_cepstrum_peak_f32(const float *src, uint16_t q_min, uint16_t q_max, float *res, uint32_t *idx);
+
+/** @} */
+
+/**
+ * @defgroup window Window
+ * @details This group provides window functions generation.
+ * @{
+ */
+
+/**
+ * @brief Floating-point Hamming window generator.
+ * @param[in] dst Pointer to the output vector
+ * @param[in] block_size Number of samples in the output vector
+ */
+void ispu_hamming_f32(float *dst, uint32_t block_size);
+
+/**
+ * @brief Floating-point Hanning window generator.
+ * @param[in] dst Pointer to the output vector
+ * @param[in] block_size Number of samples in the output vector
+ */
+void ispu_hanning_f32(float *dst, uint32_t block_size);
+
+/** @} */
+
+#endif
+
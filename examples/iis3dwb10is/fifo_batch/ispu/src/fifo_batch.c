@@ -0,0 +1,59 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#include "fifo_batch.h"
+#include "peripherals.h"
+#include "reg_map.h"
+
+#include <string.h>
+
+static void write_word(uint8_t tag, const uint8_t *data, uint8_t len);
+
+bool fifo_batch_write(uint8_t type, const void *data, uint8_t len)
+{
+	if (type > FIFO_BATCH_MAX_TYPE || len > FIFO_BATCH_MAX_LEN) {
+		return false;
+	}
+
+	const uint8_t *src = (const uint8_t *)data;
+	uint8_t num_words = (len == 0u) ? 1u : (uint8_t)((len + FIFO_BATCH_WORD_LEN - 1u) / FIFO_BATCH_WORD_LEN);
+
+	for (uint8_t i = 0u; i < num_words; i++) {
+		uint8_t n = (len < FIFO_BATCH_WORD_LEN) ? len : FIFO_BATCH_WORD_LEN;
+
+		write_word(FIFO_BATCH_TAG(type, num_words - 1u - i), src, n);
+
+		src += n;
+		len -= n;
+	}
+
+	return true;
+}
+
+// the FIFO entry must be written from ISPU_DOUT_11 to ISPU_DOUT_15 (10 bytes)
+static void write_word(uint8_t tag, const uint8_t *data, uint8_t len)
+{
+	cast_uint8_t(ISPU_DOUT_11) = tag;
+
+	if (len > 0u) {
+		memcpy((void *)(ISPU_DOUT_11 + 1), data, len);
+	}
+	if (len < FIFO_BATCH_WORD_LEN) {
+		memset((void *)(ISPU_DOUT_11 + 1 + len), 0, FIFO_BATCH_WORD_LEN - len);
+	}
+
+	cast_uint8_t(ISPU2FIFO_FLAG) = 0x01; // FIFO write request
+	while (cast_uint8_t(ISPU2FIFO_FLAG) == 0x01) // wait for FIFO write request completion
+		;
+}
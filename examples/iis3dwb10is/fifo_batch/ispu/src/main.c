@@ -0,0 +1,154 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#include "peripherals.h"
+#include "reg_map.h"
+#include "ispu_float.h"
+#include "fifo_batch.h"
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+
+// types of the records written to the FIFO
+#define REC_SAMPLE 1u // accelerometer sample, tag 01h
+#define REC_STATS 2u  // statistics of a block of samples
+
+#define BLOCK_LEN 256u // samples of the blocks of algo 1 (about 100 ms at 2.5 kHz)
+
+struct stats_record {
+	float mean[3];
+	float std[3];
+	int32_t min[3];
+	int32_t max[3];
+};
+
+static volatile uint16_t int_status;
+
+static volatile int32_t acc[3];
+
+// sums of the samples of the current block, minus its first sample to limit the rounding errors of the float sums
+static uint16_t block_cnt;
+static int32_t block_ofs[3];
+static float block_sum[3];
+static float block_sum_sq[3];
+static struct stats_record stats;
+
+void __attribute__ ((signal)) data_valid_interrupt(void)
+{
+	acc[0] = cast_sint32_t(ISPU_ARAW_X);
+	acc[1] = cast_sint32_t(ISPU_ARAW_Y);
+	acc[2] = cast_sint32_t(ISPU_ARAW_Z);
+}
+
+void __attribute__ ((signal)) algo_00_init(void)
+{
+}
+
+void __attribute__ ((signal)) algo_00(void)
+{
+	uint8_t rec[9];
+
+	// 24 bits per axis
+	memcpy(&rec[0], (void *)&acc[0], 3);
+	memcpy(&rec[3], (void *)&acc[1], 3);
+	memcpy(&rec[6], (void *)&acc[2], 3);
+
+	fifo_batch_write(REC_SAMPLE, rec, sizeof(rec));
+}
+
+void __attribute__ ((signal)) algo_01_init(void)
+{
+	block_cnt = 0u;
+}
+
+void __attribute__ ((signal)) algo_01(void)
+{
+	for (uint8_t i = 0u; i < 3u; i++) {
+		int32_t val = acc[i];
+
+		if (block_cnt == 0u) {
+			block_ofs[i] = val;
+			block_sum[i] = 0.0f;
+			block_sum_sq[i] = 0.0f;
+			stats.min[i] = val;
+			stats.max[i] = val;
+		}
+
+		float d = (float)(val - block_ofs[i]);
+		block_sum[i] += d;
+		block_sum_sq[i] += d * d;
+
+		if (val < stats.min[i]) {
+			stats.min[i] = val;
+		}
+		if (val > stats.max[i]) {
+			stats.max[i] = val;
+		}
+	}
+
+	block_cnt++;
+	if (block_cnt < BLOCK_LEN) {
+		return;
+	}
+	block_cnt = 0u;
+
+	for (uint8_t i = 0u; i < 3u; i++) {
+		float mean = block_sum[i] / (float)BLOCK_LEN;
+		float var = block_sum_sq[i] / (float)BLOCK_LEN - mean * mean;
+
+		stats.mean[i] = (float)block_ofs[i] + mean;
+		stats.std[i] = (var > 0.0f) ? sqrtf(var) : 0.0f;
+	}
+
+	fifo_batch_write(REC_STATS, &stats, sizeof(stats));
+}
+
+int main(void)
+{
+	// set boot end flag
+	uint8_t status = cast_uint8_t(ISPU_STATUS);
+	status = status | 0x40u;
+	cast_uint8_t(ISPU_STATUS) = status;
+
+	// enable high-priority (data valid) interrupt and algorithms interrupt request generation
+	cast_uint8_t(ISPU_GLB_CALL_EN) = 0x09;
+
+	while (true) {
+		stop_and_wait_start_pulse;
+
+		// reset status registers and interrupts
+		int_status = 0u;
+		cast_uint16_t(ISPU_INT_STATUS) = 0u;
+		cast_uint8_t(ISPU_INT_PIN) = 0u;
+
+		// trigger enabled algorithms execution
+		cast_uint32_t(ISPU_CALL_EN) = cast_uint16_t(ISPU_ALGO) << 4;
+
+		// wait for all algorithms execution
+		while (cast_uint32_t(ISPU_CALL_EN & 0xFFFF0) != 0u)
+			;
+
+		// get interrupt flags
+		uint8_t int_pin = 0u;
+		int_pin |= ((int_status & cast_uint16_t(ISPU_INT1_CTRL)) > 0u) ? 0x01u : 0x00u;
+		int_pin |= ((int_status & cast_uint16_t(ISPU_INT2_CTRL)) > 0u) ? 0x02u : 0x00u;
+
+		// set status registers and generate interrupts
+		cast_uint16_t(ISPU_INT_STATUS) = int_status;
+		cast_uint8_t(ISPU_INT_PIN) = int_pin;
+	}
+}
+
@@ -15,12 +15,30 @@
 #include "peripherals.h"
 #include "reg_map.h"
 #include "ispu_float.h"
+#include "scheduler.h"
 
 #include <stdint.h>
 #include <stdbool.h>
 
+// ISPU clock frequency and time slot rate, they give the cycle budget of a time slot for the scheduler. The Makefile
+// takes them from conf.txt (ispu_rate), the values below are used by the Eclipse project and must be kept aligned with
+// conf.txt.
+#ifndef ISPU_CLOCK_HZ
+#define ISPU_CLOCK_HZ 40e6
+#endif
+#ifndef ISPU_RATE_HZ
+#define ISPU_RATE_HZ 2.5e3
+#endif
+#define SCHEDULER_BUDGET ((uint32_t)(ISPU_CLOCK_HZ / ISPU_RATE_HZ))
+
 static volatile uint16_t int_status;
 
+// scheduling of the algorithms (one entry per algorithm, see the README): rate divider, phase, estimated cycles,
+// priority
+static const struct scheduler_algo sched[] = {
+	{ 1u, 0u, 0u, SCHEDULER_PRIO_MANDATORY }, // algo 0
+};
+
 void __attribute__ ((signal)) data_valid_interrupt(void)
 {
 	// TODO: read sensor data
@@ -54,6 +72,8 @@ int main(void)
 	// enable high-priority (data valid) interrupt, low-priority interrupt, and algorithms interrupts
 	cast_uint8_t(ISPU_GLB_CALL_EN) = 0x0D;
 
+	scheduler_init(sched, sizeof(sched) / sizeof(sched[0]), SCHEDULER_BUDGET);
+
 	while (true) {
 		stop_and_wait_start_pulse;
 
@@ -62,8 +82,9 @@ int main(void)
 		cast_uint16_t(ISPU_INT_STATUS) = 0u;
 		cast_uint8_t(ISPU_INT_PIN) = 0u;
 
-		// trigger enabled algorithms execution
-		cast_uint32_t(ISPU_CALL_EN) = cast_uint16_t(ISPU_ALGO) << 4;
+		// trigger execution of the enabled algorithms that are due in this time slot, according to their rate dividers
+		// and the cycle budget
+		cast_uint32_t(ISPU_CALL_EN) = scheduler_next(cast_uint16_t(ISPU_ALGO)) << 4;
 
 		// wait for all algorithms execution
 		while (cast_uint32_t(ISPU_CALL_EN & 0xFFFF0) != 0u)
@@ -15,9 +15,41 @@
 #ifndef NETWORK_UTILS_H
 #define NETWORK_UTILS_H
 
+#include <stdint.h>
+#include <stdbool.h>
+
 #include "stai.h"
+#include "network.h"
+
+// sliding window of samples kept in a ring buffer, so that no sample is moved when the window advances
+struct input_window {
+	float *buf;        // ring buffer of len samples of channels values each
+	uint16_t len;      // window length [samples]
+	uint16_t channels; // values per sample
+	uint16_t hop;      // samples between two consecutive windows
+	uint16_t pos;      // position of the oldest sample, overwritten by the next one
+	uint16_t count;    // samples added since the last complete window
+	bool full;         // true after the first complete window
+};
 
 void init_network_buffers(stai_network *net, stai_ptr *input_buffers, stai_ptr *output_buffers);
 
+// initializes the window on buf (len * channels values), the windows overlap by len - hop samples (hop equal to len,
+// or 0, for consecutive windows without overlap)
+void init_input_window(struct input_window *win, float *buf, uint16_t len, uint16_t channels, uint16_t hop);
+
+// adds a sample (channels values), returns true when a new window is complete (after the first len samples, then
+// every hop samples)
+bool push_input_window(struct input_window *win, const float *sample);
+
+// copies the window, from the oldest to the newest sample, to the input buffer of the network
+void copy_input_window(const struct input_window *win, stai_ptr input);
+
+#ifdef STAI_NETWORK_RUN_NODES
+// runs at most max_nodes nodes of the inference starting from *node, which is updated to the next node to run (the
+// inference is complete, or has failed, when it reaches STAI_NETWORK_NODES_NUM)
+stai_return_code run_network_step(stai_network *net, stai_size *node, stai_size max_nodes);
+#endif
+
 #endif
 
@@ -0,0 +1,56 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#ifndef SPECTRAL_FEATURES_H
+#define SPECTRAL_FEATURES_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "ispu_dsp.h"
+
+// length of the buffers to be provided to spectral_features_init
+#define SPECTRAL_FEATURES_EDGES_LEN(num_filters) ((num_filters) + 2u)
+#define SPECTRAL_FEATURES_SLOPES_LEN(num_filters) (2u * (num_filters))
+#define SPECTRAL_FEATURES_DCT_LEN(num_filters, num_coeffs) ((num_filters) * (num_coeffs))
+
+// number of features written by spectral_features_run
+#define SPECTRAL_FEATURES_OUT_LEN(num_filters, num_coeffs) (((num_coeffs) > 0u) ? (num_coeffs) : (num_filters))
+
+struct spectral_features_conf {
+	uint16_t fft_len; // FFT length (32, 64, 128, 256, 512, 1024, or 2048)
+	uint16_t num_filters; // Number of triangular filters (must be lower than fft_len / 2)
+	uint16_t num_coeffs; // Number of DCT coefficients (at most num_filters, 0 to output the log filterbank energies)
+	float odr; // Sensor output data rate [Hz]
+	float f_min; // Lower edge of the first filter [Hz]
+	float f_max; // Upper edge of the last filter [Hz] (greater than f_min, at most odr / 2)
+	bool mel; // Mel-spaced (true) or linearly spaced (false) filters
+};
+
+struct spectral_features {
+	struct spectral_features_conf conf;
+	struct ispu_rfft_instance_f32 rfft;
+	const float *window; // Window applied before the FFT (fft_len values, NULL for rectangular)
+	float *edges; // Filter edges in FFT bins (SPECTRAL_FEATURES_EDGES_LEN values)
+	float *slopes; // Rising and falling slopes of each filter (SPECTRAL_FEATURES_SLOPES_LEN values)
+	float *dct; // DCT-II matrix (SPECTRAL_FEATURES_DCT_LEN values, unused if num_coeffs is 0)
+};
+
+// returns -1 if the configuration is not valid
+int spectral_features_init(struct spectral_features *sf, const struct spectral_features_conf *conf, const float *window,
+                           float *edges, float *slopes, float *dct);
+void spectral_features_run(struct spectral_features *sf, float *data, float *out, uint16_t out_stride);
+
+#endif
+
@@ -22,6 +22,30 @@
 #include "stai.h"
 #include "network.h"
 #include "network_utils.h"
+#include "spectral_features.h"
+
+// optional spectral feature stage computing the input of the network from a window of samples (see the README), set
+// to 1 to enable it
+#ifndef SPECTRAL_FEATURES
+#define SPECTRAL_FEATURES 0
+#endif
+
+#if SPECTRAL_FEATURES
+#define FFT_LEN 256u
+#define NUM_FILTERS 24u
+#define NUM_COEFFS 13u
+
+#if SPECTRAL_FEATURES_OUT_LEN(NUM_FILTERS, NUM_COEFFS) > STAI_NETWORK_IN_1_SIZE
+#error "the spectral features do not fit in the input of the network"
+#endif
+
+static struct spectral_features sf;
+static float sf_window[FFT_LEN];
+static float sf_edges[SPECTRAL_FEATURES_EDGES_LEN(NUM_FILTERS)];
+static float sf_slopes[SPECTRAL_FEATURES_SLOPES_LEN(NUM_FILTERS)];
+static float sf_dct[SPECTRAL_FEATURES_DCT_LEN(NUM_FILTERS, NUM_COEFFS)];
+static float sf_samples[FFT_LEN];
+#endif
 
 static __attribute__((aligned(8))) stai_network net[STAI_NETWORK_CONTEXT_SIZE];
 
@@ -46,6 +70,23 @@ void __attribute__ ((signal)) algo_00_init(void)
 	(void)stai_network_init(net); // initialize the network context
 
 	init_network_buffers(net, input_buffers, output_buffers);
+
+#if SPECTRAL_FEATURES
+	const struct spectral_features_conf sf_conf = {
+		.fft_len = FFT_LEN,
+		.num_filters = NUM_FILTERS,
+		.num_coeffs = NUM_COEFFS,
+		.odr = 26667.0f,
+		.f_min = 0.0f,
+		.f_max = 13333.0f,
+		.mel = true,
+	};
+
+	ispu_hanning_f32(sf_window, FFT_LEN);
+	if (spectral_features_init(&sf, &sf_conf, sf_window, sf_edges, sf_slopes, sf_dct) != 0) {
+		#warning "Handle invalid spectral feature configuration as deemed appropriate."
+	}
+#endif
 }
 
 void __attribute__ ((signal)) algo_00(void)
@@ -53,6 +94,11 @@ void __attribute__ ((signal)) algo_00(void)
 	#warning "Fill the input data buffers contained in input_buffers."
 	#warning "Each buffer in input_buffers must be cast to the appropriate type before accessing it."
 
+#if SPECTRAL_FEATURES
+	#warning "Acquire FFT_LEN samples in sf_samples, which is overwritten by the computation of the features."
+	spectral_features_run(&sf, sf_samples, (float *)input_buffers[0], 1u);
+#endif
+
 	#warning "The network inference must be run when the input data buffers are ready."
 	stai_return_code res = stai_network_run(net, STAI_MODE_SYNC);
 	if (res >= STAI_ERROR_GENERIC) {
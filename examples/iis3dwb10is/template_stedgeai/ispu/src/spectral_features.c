@@ -0,0 +1,139 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <math.h>
+
+#include "ispu_dsp.h"
+#include "spectral_features.h"
+
+#define LOG_FLOOR 1.0e-12f
+
+static float hz_to_scale(float f, bool mel)
+{
+	return mel ? 2595.0f * log10f(1.0f + f / 700.0f) : f;
+}
+
+static float scale_to_hz(float s, bool mel)
+{
+	return mel ? 700.0f * (powf(10.0f, s / 2595.0f) - 1.0f) : s;
+}
+
+int spectral_features_init(struct spectral_features *sf, const struct spectral_features_conf *conf, const float *window,
+                           float *edges, float *slopes, float *dct)
+{
+	uint16_t n_filt = conf->num_filters;
+
+	// the energies are stored in the upper half of the sample buffer, and the DCT-II of num_filters energies has at
+	// most num_filters coefficients
+	if (n_filt == 0u || n_filt >= conf->fft_len / 2u || conf->num_coeffs > n_filt)
+		return -1;
+
+	// the filters must lie between 0 Hz and the Nyquist frequency, with distinct edges
+	if (conf->odr <= 0.0f || conf->f_min < 0.0f || conf->f_max <= conf->f_min || conf->f_max > 0.5f * conf->odr)
+		return -1;
+
+	if (ispu_rfft_init_f32(&sf->rfft, conf->fft_len) != 0)
+		return -1;
+
+	sf->conf = *conf;
+	sf->window = window;
+	sf->edges = edges;
+	sf->slopes = slopes;
+	sf->dct = dct;
+
+	// filter edges equally spaced on the selected scale, expressed in (fractional) FFT bins
+	float s_min = hz_to_scale(conf->f_min, conf->mel);
+	float s_step = (hz_to_scale(conf->f_max, conf->mel) - s_min) / (float)(n_filt + 1u);
+	float bins_per_hz = (float)conf->fft_len / conf->odr;
+
+	for (uint16_t m = 0; m < n_filt + 2u; m++)
+		edges[m] = scale_to_hz(s_min + (float)m * s_step, conf->mel) * bins_per_hz;
+
+	// precompute the slopes so that no division is needed at run time
+	for (uint16_t m = 0; m < n_filt; m++) {
+		slopes[2u * m] = 1.0f / (edges[m + 1u] - edges[m]);
+		slopes[2u * m + 1u] = 1.0f / (edges[m + 2u] - edges[m + 1u]);
+	}
+
+	// orthonormal DCT-II matrix
+	if (conf->num_coeffs > 0u) {
+		float k = (float)M_PI / (float)n_filt;
+		float norm0 = sqrtf(1.0f / (float)n_filt);
+		float norm = sqrtf(2.0f / (float)n_filt);
+
+		for (uint16_t c = 0; c < conf->num_coeffs; c++) {
+			for (uint16_t m = 0; m < n_filt; m++)
+				dct[c * n_filt + m] = (c == 0u ? norm0 : norm) * cosf(k * ((float)m + 0.5f) * (float)c);
+		}
+	}
+
+	return 0;
+}
+
+void spectral_features_run(struct spectral_features *sf, float *data, float *out, uint16_t out_stride)
+{
+	uint16_t half = sf->conf.fft_len / 2u;
+	uint16_t n_filt = sf->conf.num_filters;
+
+	if (sf->window != NULL)
+		ispu_mult_f32(data, sf->window, data, sf->conf.fft_len);
+
+	ispu_rfft_f32(&sf->rfft, data);
+
+	// power spectrum of bins 0 to fft_len / 2 computed in place, data[1] holds the Nyquist bin after the FFT
+	float nyq = data[1];
+	ispu_cmplx_mag_squared_f32(&data[2], &data[1], half - 1u);
+	data[0] = data[0] * data[0];
+	data[half] = nyq * nyq;
+
+	// log filterbank energies stored after the power spectrum, which is no longer needed once consumed
+	float *energies = &data[half + 1u];
+	uint16_t last_bin = half;
+
+	for (uint16_t m = 0; m < n_filt; m++) {
+		float lo = sf->edges[m];
+		float mid = sf->edges[m + 1u];
+		float hi = sf->edges[m + 2u];
+		float e = 0.0f;
+
+		uint16_t k = (uint16_t)ceilf(lo);
+		for (; k <= last_bin && (float)k <= mid; k++)
+			e += data[k] * ((float)k - lo) * sf->slopes[2u * m];
+		for (; k <= last_bin && (float)k < hi; k++)
+			e += data[k] * (hi - (float)k) * sf->slopes[2u * m + 1u];
+
+		energies[m] = logf(e + LOG_FLOOR);
+	}
+
+	if (sf->conf.num_coeffs == 0u) {
+		for (uint16_t m = 0; m < n_filt; m++)
+			out[m * out_stride] = energies[m];
+	} else {
+		const float *row = sf->dct;
+
+		for (uint16_t c = 0; c < sf->conf.num_coeffs; c++) {
+			float acc = 0.0f;
+
+			for (uint16_t m = 0; m < n_filt; m++)
+				acc += row[m] * energies[m];
+
+			out[c * out_stride] = acc;
+			row += n_filt;
+		}
+	}
+}
+
@@ -0,0 +1,48 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#ifndef GATE_H
+#define GATE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define GATE_MAX_ALGOS 32
+
+// state of a gated algorithm at the beginning of its execution
+#define GATE_RUNNING 0u // running continuously
+#define GATE_RESUMED 1u // first execution after being gated off, the state kept since then may be warm-started
+#define GATE_WARMUP 2u  // executions following the resume, the outputs may not be reliable yet
+
+struct gate_algo {
+	uint32_t triggers; // mask of the triggers (bit 0 for trigger 0, etc.) enabling the algorithm, 0 if never gated
+	uint16_t hold;     // time slots the algorithm keeps running after all its triggers became inactive
+	uint16_t warmup;   // executions after the resume reported as GATE_WARMUP
+};
+
+// algos[i] configures algorithm i, the algorithms beyond num_algos are never gated
+void gate_init(const struct gate_algo *algos, uint8_t num_algos);
+
+// sets the state of a trigger, usually from the detector algorithm that owns it
+void gate_set(uint8_t trigger, bool active);
+
+// returns the enabled algorithms (bit 0 for algo 0, etc.) that are not gated off in the current time slot, based on
+// the triggers set up to the previous time slot
+uint32_t gate_update(uint32_t enabled);
+
+// returns the state (GATE_RUNNING, GATE_RESUMED, or GATE_WARMUP) of a gated algorithm, to be called once per execution
+uint8_t gate_state(uint8_t algo);
+
+#endif
+
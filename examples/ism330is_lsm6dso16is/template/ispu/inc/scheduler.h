@@ -0,0 +1,53 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <stdint.h>
+
+#define SCHEDULER_MAX_ALGOS 32
+
+// priority of the algorithms that run whenever they are released, regardless of the cycle budget
+#define SCHEDULER_PRIO_MANDATORY 0
+
+// time slots an algorithm can be deferred in a row before running regardless of the cycle budget, so that an
+// algorithm that never fits is not starved
+#define SCHEDULER_MAX_WAIT 16
+
+struct scheduler_algo {
+	uint16_t div;    // the algorithm is released every div time slots (0 or 1 for every time slot)
+	uint16_t phase;  // time slot of the first release, in [0, div - 1], to spread heavy algorithms over time
+	uint32_t cycles; // estimated number of cycles of one execution, charged to the cycle budget
+	uint8_t prio;    // 0 for mandatory algorithms, then the lower the value, the higher the priority
+};
+
+struct scheduler_stats {
+	uint32_t deferrals; // executions postponed to a later time slot because the cycle budget was used up
+	uint32_t missed;    // releases dropped because the previous release of the same algorithm was still deferred
+	uint32_t forced;    // executions admitted over the cycle budget after being deferred SCHEDULER_MAX_WAIT times
+	uint32_t overruns;  // time slots where the estimated cycles of the admitted algorithms exceeded the budget
+};
+
+// algos[i] configures algorithm i, the algorithms beyond num_algos run in every time slot without being charged.
+// budget is the number of cycles available for the algorithms in a time slot (0 to disable the deferral).
+void scheduler_init(const struct scheduler_algo *algos, uint8_t num_algos, uint32_t budget);
+
+// returns the mask of the algorithms to run in the current time slot among the enabled ones (bit 0 for algo 0, etc.)
+uint32_t scheduler_next(uint32_t enabled);
+
+const struct scheduler_stats *scheduler_get_stats(void);
+
+#endif
+
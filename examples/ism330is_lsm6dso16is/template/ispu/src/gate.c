@@ -0,0 +1,117 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#include "gate.h"
+
+static const struct gate_algo *gate_algos;
+static uint8_t gate_num_algos;
+
+// active triggers
+static uint32_t triggers;
+
+// gated algorithms not gated off in the previous time slot, already executed, resumed and not executed yet
+static uint32_t open;
+static uint32_t started;
+static uint32_t resumed;
+
+// time slots left before gating off each algorithm and executions left before the end of its warm-up
+static uint16_t hold[GATE_MAX_ALGOS];
+static uint16_t warmup[GATE_MAX_ALGOS];
+
+void gate_init(const struct gate_algo *algos, uint8_t num_algos)
+{
+	if (num_algos > GATE_MAX_ALGOS) {
+		num_algos = GATE_MAX_ALGOS;
+	}
+
+	gate_algos = algos;
+	gate_num_algos = num_algos;
+
+	triggers = 0u;
+	open = 0u;
+	started = 0u;
+	resumed = 0u;
+
+	for (uint8_t i = 0u; i < num_algos; i++) {
+		hold[i] = 0u;
+		warmup[i] = 0u;
+	}
+}
+
+void gate_set(uint8_t trigger, bool active)
+{
+	uint32_t bit = 1ul << trigger;
+
+	if (active) {
+		triggers |= bit;
+	} else {
+		triggers &= ~bit;
+	}
+}
+
+uint32_t gate_update(uint32_t enabled)
+{
+	uint32_t closed = 0u;
+
+	for (uint8_t i = 0u; i < gate_num_algos; i++) {
+		uint32_t bit = 1ul << i;
+		uint32_t mask = gate_algos[i].triggers;
+
+		if (mask == 0u) {
+			continue;
+		}
+
+		if ((triggers & mask) != 0u) {
+			hold[i] = gate_algos[i].hold;
+		} else if (hold[i] > 0u) {
+			hold[i]--;
+		} else {
+			closed |= bit;
+			open &= ~bit;
+			continue;
+		}
+
+		// an algorithm that has never been executed is initialized by its first execution instead of being resumed
+		if ((open & bit) == 0u && (started & bit) != 0u) {
+			resumed |= bit;
+		}
+		open |= bit;
+	}
+
+	return enabled & ~closed;
+}
+
+uint8_t gate_state(uint8_t algo)
+{
+	uint32_t bit = 1ul << algo;
+
+	if (algo >= gate_num_algos || gate_algos[algo].triggers == 0u) {
+		return GATE_RUNNING;
+	}
+
+	started |= bit;
+
+	if ((resumed & bit) != 0u) {
+		resumed &= ~bit;
+		warmup[algo] = gate_algos[algo].warmup;
+		return GATE_RESUMED;
+	}
+
+	if (warmup[algo] > 0u) {
+		warmup[algo]--;
+		return GATE_WARMUP;
+	}
+
+	return GATE_RUNNING;
+}
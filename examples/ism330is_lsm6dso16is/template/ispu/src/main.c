@@ -14,6 +14,8 @@
 
 #include "peripherals.h"
 #include "reg_map.h"
+#include "scheduler.h"
+#include "gate.h"
 
 #include <stdint.h>
 #include <stdbool.h>
@@ -21,8 +23,31 @@
 void __attribute__ ((signal)) algo_00_init(void);
 void __attribute__ ((signal)) algo_00(void);
 
+// ISPU clock frequency and time slot rate, they give the cycle budget of a time slot for the scheduler. The Makefile
+// takes them from conf.txt (ispu_clock and ispu_irq_rate), the values below are used by the Eclipse project and must be
+// kept aligned with conf.txt.
+#ifndef ISPU_CLOCK_HZ
+#define ISPU_CLOCK_HZ 5e6
+#endif
+#ifndef ISPU_RATE_HZ
+#define ISPU_RATE_HZ 26
+#endif
+#define SCHEDULER_BUDGET ((uint32_t)(ISPU_CLOCK_HZ / ISPU_RATE_HZ))
+
 static volatile uint32_t int_status;
 
+// scheduling of the algorithms (one entry per algorithm, see the README): rate divider, phase, estimated cycles,
+// priority
+static const struct scheduler_algo sched[] = {
+	{ 1u, 0u, 0u, SCHEDULER_PRIO_MANDATORY }, // algo 0
+};
+
+// gating of the algorithms by the triggers of lightweight detectors (one entry per algorithm, see the README):
+// triggers, hold time slots, warm-up executions
+static const struct gate_algo gate[] = {
+	{ 0u, 0u, 0u }, // algo 0 (never gated)
+};
+
 void __attribute__ ((signal)) algo_00_init(void)
 {
 	// TODO: initialize algorithm
@@ -49,6 +74,9 @@ int main(void)
 	// enable algorithms interrupt request generation
 	cast_uint8_t(ISPU_GLB_CALL_EN) = 0x01u;
 
+	scheduler_init(sched, sizeof(sched) / sizeof(sched[0]), SCHEDULER_BUDGET);
+	gate_init(gate, sizeof(gate) / sizeof(gate[0]));
+
 	while (true) {
 		stop_and_wait_start_pulse;
 
@@ -57,8 +85,9 @@ int main(void)
 		cast_uint32_t(ISPU_INT_STATUS) = 0u;
 		cast_uint8_t(ISPU_INT_PIN) = 0u;
 
-		// get all the algorithms to run in this time slot
-		cast_uint32_t(ISPU_CALL_EN) = cast_uint32_t(ISPU_ALGO) << 1;
+		// get all the algorithms to run in this time slot, according to their gating triggers, their rate dividers, and
+		// the cycle budget
+		cast_uint32_t(ISPU_CALL_EN) = scheduler_next(gate_update(cast_uint32_t(ISPU_ALGO))) << 1;
 
 		// wait for all algorithms execution
 		while (cast_uint32_t(ISPU_CALL_EN) != 0u) {
@@ -0,0 +1,165 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#include "scheduler.h"
+
+#include <stdbool.h>
+
+static const struct scheduler_algo *sched_algos;
+static uint8_t sched_num_algos;
+static uint32_t sched_budget;
+
+// algorithms sorted by priority (stable, so that the index breaks ties)
+static uint8_t order[SCHEDULER_MAX_ALGOS];
+
+// time slots left before the next release of each algorithm
+static uint16_t countdown[SCHEDULER_MAX_ALGOS];
+
+// consecutive time slots each pending algorithm has been deferred
+static uint16_t waits[SCHEDULER_MAX_ALGOS];
+
+// released and not executed yet, deferred in the previous time slot
+static uint32_t pending;
+static uint32_t late;
+
+static struct scheduler_stats stats;
+
+void scheduler_init(const struct scheduler_algo *algos, uint8_t num_algos, uint32_t budget)
+{
+	if (num_algos > SCHEDULER_MAX_ALGOS) {
+		num_algos = SCHEDULER_MAX_ALGOS;
+	}
+
+	sched_algos = algos;
+	sched_num_algos = num_algos;
+	sched_budget = budget;
+
+	for (uint8_t i = 0u; i < num_algos; i++) {
+		uint16_t div = algos[i].div;
+		countdown[i] = (div > 1u) ? (algos[i].phase % div) : 0u;
+		waits[i] = 0u;
+
+		uint8_t j = i;
+		while (j > 0u && algos[order[j - 1u]].prio > algos[i].prio) {
+			order[j] = order[j - 1u];
+			j--;
+		}
+		order[j] = i;
+	}
+
+	pending = 0u;
+	late = 0u;
+	stats.deferrals = 0u;
+	stats.missed = 0u;
+	stats.forced = 0u;
+	stats.overruns = 0u;
+}
+
+uint32_t scheduler_next(uint32_t enabled)
+{
+	uint32_t released = 0u;
+	uint32_t table = 0u;
+
+	// the countdowns run also while the algorithms are disabled, so that the phases are kept
+	for (uint8_t i = 0u; i < sched_num_algos; i++) {
+		uint32_t bit = 1ul << i;
+		table |= bit;
+
+		if (countdown[i] == 0u) {
+			uint16_t div = sched_algos[i].div;
+			countdown[i] = (div > 1u) ? (div - 1u) : 0u;
+			released |= bit;
+		} else {
+			countdown[i]--;
+		}
+	}
+	released &= enabled;
+
+	for (uint32_t m = pending & released; m != 0u; m &= m - 1u) {
+		stats.missed++;
+	}
+	pending = (pending & enabled) | released;
+
+	uint32_t run = enabled & ~table;
+	uint32_t used = 0u;
+
+	// the mandatory algorithms run whenever they are released, their cycles are charged before admitting the others
+	for (uint8_t i = 0u; i < sched_num_algos; i++) {
+		uint32_t bit = 1ul << i;
+
+		if ((pending & bit) != 0u && sched_algos[i].prio == SCHEDULER_PRIO_MANDATORY) {
+			run |= bit;
+			used += sched_algos[i].cycles;
+		}
+	}
+
+	uint32_t mandatory_used = used;
+	bool deferring = false;
+
+	// the algorithms deferred in the previous time slot are admitted first, then the ones released in this time slot,
+	// each group by priority
+	for (uint8_t k = 0u; k < 2u * sched_num_algos; k++) {
+		bool aged = k < sched_num_algos;
+		uint8_t i = order[aged ? k : (k - sched_num_algos)];
+		uint32_t bit = 1ul << i;
+
+		if ((pending & bit) == 0u || ((late & bit) != 0u) != aged || sched_algos[i].prio == SCHEDULER_PRIO_MANDATORY) {
+			continue;
+		}
+
+		uint32_t cycles = sched_algos[i].cycles;
+		bool fits = (sched_budget == 0u) || (used + cycles <= sched_budget);
+		bool starved = waits[i] >= SCHEDULER_MAX_WAIT;
+
+		// once an algorithm is deferred, the following ones are deferred too, so that they do not take its place; an
+		// algorithm that does not fit even next to the mandatory ones alone does not hold back the others, and runs
+		// anyway once it has waited SCHEDULER_MAX_WAIT time slots
+		if (!starved && (deferring || !fits)) {
+			if (!fits && mandatory_used + cycles <= sched_budget) {
+				deferring = true;
+			}
+			waits[i]++;
+			stats.deferrals++;
+			continue;
+		}
+
+		if (starved && (deferring || !fits)) {
+			stats.forced++;
+		}
+
+		run |= bit;
+		used += cycles;
+	}
+
+	pending &= ~run;
+	late = pending;
+
+	for (uint8_t i = 0u; i < sched_num_algos; i++) {
+		if ((pending & (1ul << i)) == 0u) {
+			waits[i] = 0u;
+		}
+	}
+
+	if (sched_budget != 0u && used > sched_budget) {
+		stats.overruns++;
+	}
+
+	return run;
+}
+
+const struct scheduler_stats *scheduler_get_stats(void)
+{
+	return &stats;
+}
+
@@ -0,0 +1,459 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <signal.h>
+#include <getopt.h>
+
+#include "ispu_host.h"
+#include "ispu_host_mock.h"
+
+#define SPI_SPEED_HZ 5000000u
+#define WAIT_PERIOD_MS 100
+#define VALUE_LEN 1024u
+
+static volatile sig_atomic_t stop;
+
+static void usage(const char *prog)
+{
+	fprintf(stderr, "Usage: %s [options] <conf.h|conf.json>\n", prog);
+	fprintf(stderr, "  -s <dev>   SPI device (e.g. /dev/spidev0.0)\n");
+	fprintf(stderr, "  -f <Hz>    SPI clock frequency (default: %u)\n", SPI_SPEED_HZ);
+	fprintf(stderr, "  -i <dev>   I2C device (e.g. /dev/i2c-1)\n");
+	fprintf(stderr, "  -m <bus>   in-memory mock device on the spi or i2c bus, instead of a sensor\n");
+	fprintf(stderr, "  -g <chip>  GPIO chip of the INT1 line (e.g. /dev/gpiochip0), the interrupt status is polled if\n");
+	fprintf(stderr, "             not specified\n");
+	fprintf(stderr, "  -l <line>  GPIO line connected to INT1\n");
+	fprintf(stderr, "  -b <file>  program images generated by ispu_pack.py (.bin) loaded instead of the configuration\n");
+	fprintf(stderr, "  -o <file>  output description file (meta.txt) replacing the outputs of the configuration\n");
+	fprintf(stderr, "  -v         read back the ISPU RAM after loading and exit with an error if it differs from the\n");
+	fprintf(stderr, "             configuration\n");
+	fprintf(stderr, "  -n <num>   number of interrupts after which to exit (default: 0, run until interrupted)\n");
+	fprintf(stderr, "  -t <ms>    timeout waiting for the interrupt (default: none)\n");
+	fprintf(stderr, "  -x         print the outputs only in numerical form, without labels\n");
+	fprintf(stderr, "  -w <num>   read the specified number of FIFO words (watermark) at each interrupt and print the\n");
+	fprintf(stderr, "             records written by the ISPU instead of the outputs (requires -g with a sensor)\n");
+}
+
+static void on_signal(int sig)
+{
+	(void)sig;
+	stop = 1;
+}
+
+static uint8_t *read_image(const char *path, uint32_t *len)
+{
+	FILE *f = fopen(path, "rb");
+	if (f == NULL)
+		return NULL;
+
+	uint8_t *buf = NULL;
+	long size = -1;
+
+	if (fseek(f, 0, SEEK_END) == 0)
+		size = ftell(f);
+	if (size > 0 && fseek(f, 0, SEEK_SET) == 0)
+		buf = malloc((size_t)size);
+	if (buf != NULL && fread(buf, 1, (size_t)size, f) != (size_t)size) {
+		free(buf);
+		buf = NULL;
+	}
+
+	fclose(f);
+	*len = (uint32_t)size;
+
+	return buf;
+}
+
+// the mock does not run the program: each output element is set to the index of the sample, in its type
+static void mock_sample(const struct ispu_host_transport *tr, const struct ispu_host_sensor *sensor, uint32_t n)
+{
+	for (uint16_t j = 0; j < sensor->num_outputs; j++) {
+		const struct ispu_host_output *out = &sensor->outputs[j];
+		uint8_t size = ispu_host_type_size(out->type);
+		uint8_t value[8];
+
+		if (out->type == ISPU_HOST_TYPE_CHAR) {
+			char str[256] = { 0 };
+			snprintf(str, sizeof(str), "sample %lu", (unsigned long)n);
+			ispu_host_mock_set_outputs(tr, out->reg_addr, (uint8_t *)str, out->len < sizeof(str) ? out->len : 0);
+			continue;
+		}
+
+		float f = (float)n;
+		double d = (double)n;
+		uint64_t u = n;
+
+		if (out->type == ISPU_HOST_TYPE_FLOAT)
+			memcpy(value, &f, sizeof(f));
+		else if (out->type == ISPU_HOST_TYPE_DOUBLE)
+			memcpy(value, &d, sizeof(d));
+		else if (out->type == ISPU_HOST_TYPE_HALF)
+			memset(value, 0, sizeof(value));
+		else
+			memcpy(value, &u, sizeof(u));
+
+		for (uint16_t k = 0; k < out->len; k++)
+			ispu_host_mock_set_outputs(tr, out->reg_addr + k * size, value, size);
+	}
+
+	ispu_host_mock_raise_int(tr, 0x01);
+}
+
+// the mock does not run the program: records of one FIFO word, with the index of the record as data, are written with a
+// record of six words every eight records, until the watermark is reached, so that the records span multiple reads
+static void mock_fifo_sample(const struct ispu_host_transport *tr, uint32_t num_words)
+{
+	static uint32_t n;
+	uint8_t word[ISPU_HOST_FIFO_WORD_LEN] = { 0 };
+	uint32_t count = 0;
+
+	while (count < num_words) {
+		uint8_t type = n % 8 == 7 ? 2 : 1;
+		uint8_t num_rec_words = type == 2 ? 6 : 1;
+
+		for (uint8_t k = 0; k < num_rec_words; k++) {
+			word[0] = (uint8_t)(((num_rec_words - 1 - k) << 5) | type);
+			memcpy(&word[1], &n, sizeof(n));
+			word[5] = k;
+			count = ispu_host_mock_push_fifo(tr, word);
+		}
+		n++;
+	}
+
+	ispu_host_mock_raise_int(tr, 0x01);
+}
+
+static void print_header(const struct ispu_host_conf *conf)
+{
+	uint8_t outputs = 0;
+
+	for (uint32_t i = 0; i < conf->num_sensors; i++) {
+		for (uint16_t j = 0; j < conf->sensors[i].num_outputs; j++) {
+			const struct ispu_host_output *out = &conf->sensors[i].outputs[j];
+
+			if (outputs)
+				printf("\t");
+			outputs = 1;
+
+			// handle char arrays as len = 1 as they are strings
+			if (out->len == 1 || out->type == ISPU_HOST_TYPE_CHAR) {
+				printf("%s", out->name);
+			} else {
+				for (uint16_t k = 0; k < out->len; k++)
+					printf("%s%s[%u]", k > 0 ? "\t" : "", out->name, k);
+			}
+		}
+	}
+
+	if (outputs)
+		printf("\n");
+}
+
+static int print_outputs(struct ispu_host *host, const struct ispu_host_conf *conf, uint8_t *data, bool labels)
+{
+	uint8_t outputs = 0;
+	char str[VALUE_LEN];
+
+	for (uint32_t i = 0; i < conf->num_sensors; i++) {
+		const struct ispu_host_sensor *sensor = &conf->sensors[i];
+		const uint8_t *p = data;
+
+		if (ispu_host_read_outputs(host, sensor, data) != 0)
+			return -1;
+
+		for (uint16_t j = 0; j < sensor->num_outputs; j++) {
+			const struct ispu_host_output *out = &sensor->outputs[j];
+
+			ispu_host_format_output(out, p, labels, str, sizeof(str));
+			printf("%s%s", outputs ? "\t" : "", str);
+			outputs = 1;
+			p += out->len * ispu_host_type_size(out->type);
+		}
+	}
+
+	if (outputs)
+		printf("\n");
+	fflush(stdout);
+
+	return 0;
+}
+
+static int print_records(struct ispu_host *host, struct ispu_host_fifo_parser *parser, uint8_t *words,
+                         uint32_t num_words)
+{
+	if (ispu_host_read_fifo(host, words, num_words) != 0)
+		return -1;
+
+	for (uint32_t i = 0; i < num_words; i++) {
+		if (!ispu_host_fifo_parse(parser, &words[i * ISPU_HOST_FIFO_WORD_LEN]))
+			continue;
+
+		printf("%u\t", parser->rec.type);
+		for (uint8_t k = 0; k < parser->rec.len; k++)
+			printf("%02X", parser->rec.data[k]);
+		printf("\n");
+	}
+	fflush(stdout);
+
+	return 0;
+}
+
+int main(int argc, char **argv)
+{
+	const char *spi_path = NULL, *i2c_path = NULL, *mock_bus = NULL, *chip_path = NULL;
+	const char *image_path = NULL, *meta_path = NULL;
+	uint32_t speed_hz = SPI_SPEED_HZ, line = 0, num_int = 0, num_words = 0;
+	int32_t timeout_ms = -1;
+	bool verify = false, labels = true;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "s:f:i:m:g:l:b:o:vn:t:xw:h")) != -1) {
+		switch (opt) {
+		case 's':
+			spi_path = optarg;
+			break;
+		case 'f':
+			speed_hz = (uint32_t)strtoul(optarg, NULL, 0);
+			break;
+		case 'i':
+			i2c_path = optarg;
+			break;
+		case 'm':
+			mock_bus = optarg;
+			break;
+		case 'g':
+			chip_path = optarg;
+			break;
+		case 'l':
+			line = (uint32_t)strtoul(optarg, NULL, 0);
+			break;
+		case 'b':
+			image_path = optarg;
+			break;
+		case 'o':
+			meta_path = optarg;
+			break;
+		case 'v':
+			verify = true;
+			break;
+		case 'n':
+			num_int = (uint32_t)strtoul(optarg, NULL, 0);
+			break;
+		case 't':
+			timeout_ms = (int32_t)strtol(optarg, NULL, 0);
+			break;
+		case 'x':
+			labels = false;
+			break;
+		case 'w':
+			num_words = (uint32_t)strtoul(optarg, NULL, 0);
+			break;
+		default:
+			usage(argv[0]);
+			return opt == 'h' ? 0 : 1;
+		}
+	}
+
+	if (optind != argc - 1 || (spi_path != NULL) + (i2c_path != NULL) + (mock_bus != NULL) != 1) {
+		usage(argv[0]);
+		return 1;
+	}
+
+	struct ispu_host_conf conf;
+	if (ispu_host_conf_load(argv[optind], &conf) != 0)
+		return 1;
+
+	// the outputs described by meta.txt are the ones of the program of the first sensor
+	if (meta_path != NULL && ispu_host_conf_load_meta(meta_path, &conf.sensors[0]) != 0)
+		return 1;
+
+	// check sensor name(s) validity, only one sensor can be configured
+	const struct ispu_host_device *dev = NULL;
+	for (uint32_t i = 0; i < conf.num_sensors; i++) {
+		const struct ispu_host_device *sensor_dev = ispu_host_get_sensor_device(&conf.sensors[i]);
+
+		if (sensor_dev == NULL) {
+			fprintf(stderr, "Error: sensor ");
+			for (uint8_t j = 0; j < conf.sensors[i].num_names; j++)
+				fprintf(stderr, "%s%s", j > 0 ? " / " : "", conf.sensors[i].names[j]);
+			fprintf(stderr, " unknown\n");
+			return 1;
+		}
+
+		if (dev != NULL && dev != sensor_dev) {
+			fprintf(stderr, "Error: cannot configure multiple sensors\n");
+			return 1;
+		}
+		dev = sensor_dev;
+	}
+
+	// the FIFO watermark is signaled only on INT1, the interrupt status of the ISPU cannot be polled for it
+	if (num_words > 0 && (dev->fifo_data_out == 0 || (mock_bus == NULL && chip_path == NULL))) {
+		fprintf(stderr, "Error: %s\n", dev->fifo_data_out == 0 ? "the sensor has no FIFO" : "the FIFO requires -g");
+		return 1;
+	}
+
+	struct ispu_host_transport tr;
+	int ret;
+
+	if (spi_path != NULL)
+		ret = ispu_host_spidev_open(&tr, spi_path, speed_hz);
+	else if (i2c_path != NULL)
+		ret = ispu_host_i2cdev_open(&tr, i2c_path);
+	else
+		ret = ispu_host_mock_open(&tr, dev, strcmp(mock_bus, "i2c") == 0 ? ISPU_HOST_I2C : ISPU_HOST_SPI);
+
+	if (ret != 0) {
+		fprintf(stderr, "Error: cannot open %s\n", spi_path != NULL ? spi_path : i2c_path != NULL ? i2c_path : "mock");
+		return 1;
+	}
+
+	struct ispu_host host;
+	ispu_host_init(&host, &tr);
+
+	if (ispu_host_detect(&host, dev) != 0) {
+		fprintf(stderr, "Error: sensor ");
+		for (uint8_t j = 0; j < dev->n_dev_names; j++)
+			fprintf(stderr, "%s%s", j > 0 ? " / " : "", dev->dev_names[j]);
+		fprintf(stderr, " not found\n");
+		ispu_host_close(&host);
+		return 1;
+	}
+
+	if (ispu_host_reset(&host) != 0) {
+		fprintf(stderr, "Error: software reset failed\n");
+		ispu_host_close(&host);
+		return 1;
+	}
+
+	// load configuration
+	uint8_t *image = NULL;
+	uint32_t image_len = 0, image_pos = 0;
+	if (image_path != NULL && (image = read_image(image_path, &image_len)) == NULL) {
+		fprintf(stderr, "Error: cannot read %s\n", image_path);
+		ispu_host_close(&host);
+		return 1;
+	}
+
+	uint32_t data_size = 0;
+	ret = 0;
+
+	for (uint32_t i = 0; i < conf.num_sensors && ret == 0; i++) {
+		const struct ispu_host_sensor *sensor = &conf.sensors[i];
+
+		if (image != NULL) {
+			int32_t n = ispu_host_load_image(&host, &image[image_pos], image_len - image_pos);
+			if (n < 0) {
+				fprintf(stderr, "Error: invalid ISPU program image\n");
+				ret = -1;
+				break;
+			}
+			image_pos += (uint32_t)n;
+		} else if (ispu_host_load_ops(&host, sensor->ops, sensor->num_ops) != 0) {
+			fprintf(stderr, "Error: cannot load the configuration\n");
+			ret = -1;
+			break;
+		}
+
+		if (verify) {
+			int32_t diff = ispu_host_verify_ops(&host, sensor->ops, sensor->num_ops);
+			if (diff < 0) {
+				fprintf(stderr, "Error: cannot read the ISPU RAM\n");
+				ret = -1;
+			} else if (diff > 0) {
+				fprintf(stderr, "Error: sensor %lu: %ld bytes of the ISPU RAM differ from the configuration\n",
+				        (unsigned long)i, (long)diff);
+				ret = -1;
+			}
+		}
+
+		uint32_t size = ispu_host_outputs_size(sensor);
+		if (size > data_size)
+			data_size = size;
+	}
+
+	free(image);
+
+	if (ret == 0 && chip_path != NULL && ispu_host_int_open(&host, chip_path, line) != 0) {
+		fprintf(stderr, "Error: cannot request line %lu of %s\n", (unsigned long)line, chip_path);
+		ret = -1;
+	}
+
+	if (num_words > 0)
+		data_size = num_words * ISPU_HOST_FIFO_WORD_LEN;
+
+	uint8_t *data = malloc(data_size > 0 ? data_size : 1);
+	if (data == NULL)
+		ret = -1;
+
+	struct ispu_host_fifo_parser parser;
+	ispu_host_fifo_parser_init(&parser);
+
+	signal(SIGINT, on_signal);
+	signal(SIGTERM, on_signal);
+
+	if (ret == 0 && num_words > 0)
+		printf("type\tdata\n");
+	else if (ret == 0)
+		print_header(&conf);
+
+	uint32_t count = 0;
+	int32_t waited = 0;
+
+	while (ret == 0 && !stop && (num_int == 0 || count < num_int)) {
+		if (mock_bus != NULL && num_words > 0)
+			mock_fifo_sample(&tr, num_words);
+		else if (mock_bus != NULL)
+			mock_sample(&tr, &conf.sensors[0], count);
+
+		// short waits, so that the signals are handled also while polling the interrupt status
+		int32_t wait = timeout_ms >= 0 && timeout_ms - waited < WAIT_PERIOD_MS ? timeout_ms - waited : WAIT_PERIOD_MS;
+		int int_ret = ispu_host_wait_int(&host, wait);
+
+		if (int_ret < 0 && !stop) {
+			fprintf(stderr, "Error: cannot wait for the interrupt\n");
+			ret = -1;
+		} else if (int_ret == 0) {
+			waited += wait;
+			if (timeout_ms >= 0 && waited >= timeout_ms) {
+				fprintf(stderr, "Error: timeout waiting for the interrupt\n");
+				ret = -1;
+			}
+		} else if (int_ret > 0) {
+			waited = 0;
+			count++;
+			if (num_words > 0 && print_records(&host, &parser, data, num_words) != 0) {
+				fprintf(stderr, "Error: cannot read the FIFO\n");
+				ret = -1;
+			} else if (num_words == 0 && print_outputs(&host, &conf, data, labels) != 0) {
+				fprintf(stderr, "Error: cannot read the outputs\n");
+				ret = -1;
+			}
+		}
+	}
+
+	if (parser.lost > 0)
+		fprintf(stderr, "Warning: %lu FIFO words of broken records discarded\n", (unsigned long)parser.lost);
+
+	free(data);
+	ispu_host_close(&host);
+	ispu_host_conf_free(&conf);
+
+	return ret == 0 ? 0 : 1;
+}
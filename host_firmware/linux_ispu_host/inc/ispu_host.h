@@ -0,0 +1,206 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#ifndef ISPU_HOST_H
+#define ISPU_HOST_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// operations of the configurations generated by ispu_gen, same values and layout as struct mems_conf_op, so that the
+// lists of a C header file built into the application can be passed as they are
+enum {
+	ISPU_HOST_OP_READ = 1,
+	ISPU_HOST_OP_WRITE = 2,
+	ISPU_HOST_OP_DELAY = 3,
+	ISPU_HOST_OP_POLL_SET = 4,
+	ISPU_HOST_OP_POLL_RESET = 5
+};
+
+// types of the outputs, same values as MEMS_CONF_OUTPUT_TYPE_*
+enum {
+	ISPU_HOST_TYPE_UINT8_T = 1,
+	ISPU_HOST_TYPE_INT8_T = 2,
+	ISPU_HOST_TYPE_CHAR = 3,
+	ISPU_HOST_TYPE_UINT16_T = 4,
+	ISPU_HOST_TYPE_INT16_T = 5,
+	ISPU_HOST_TYPE_UINT32_T = 6,
+	ISPU_HOST_TYPE_INT32_T = 7,
+	ISPU_HOST_TYPE_UINT64_T = 8,
+	ISPU_HOST_TYPE_INT64_T = 9,
+	ISPU_HOST_TYPE_HALF = 10,
+	ISPU_HOST_TYPE_FLOAT = 11,
+	ISPU_HOST_TYPE_DOUBLE = 12
+};
+
+// first output register (ISPU_DOUT_00_L), where the outputs described by meta.txt start
+#define ISPU_HOST_DOUT_00 0x10
+
+#define ISPU_HOST_MAX_NAMES 2
+
+struct ispu_host_op {
+	uint8_t type;
+	uint8_t address;
+	uint8_t data;
+};
+
+struct ispu_host_result {
+	uint8_t code;
+	char *label;
+};
+
+struct ispu_host_output {
+	char *name;
+	uint8_t type;
+	uint16_t len;
+	uint8_t reg_addr;
+	uint8_t num_results;
+	struct ispu_host_result *results;
+};
+
+struct ispu_host_sensor {
+	uint8_t num_names;
+	char *names[ISPU_HOST_MAX_NAMES];
+	uint32_t num_ops;
+	struct ispu_host_op *ops;
+	uint16_t num_outputs;
+	struct ispu_host_output *outputs;
+};
+
+struct ispu_host_conf {
+	uint32_t num_sensors;
+	struct ispu_host_sensor *sensors;
+};
+
+// Records written to the FIFO by the ISPU programs using the fifo_batch module (see the fifo_batch example of the
+// IIS3DWB10IS): the tag of each FIFO word holds the type of the record in bits [4:0] and the number of words of the
+// record following the word in bits [7:5].
+#define ISPU_HOST_FIFO_WORD_LEN 10u // tag and 9 data bytes
+#define ISPU_HOST_FIFO_REC_MAX_LEN 72u
+
+struct ispu_host_fifo_record {
+	uint8_t type;
+	uint8_t len; // data bytes, including the padding of the last word
+	uint8_t data[ISPU_HOST_FIFO_REC_MAX_LEN];
+};
+
+struct ispu_host_fifo_parser {
+	struct ispu_host_fifo_record rec;
+	uint8_t left;  // words expected before the end of the current record
+	bool pending;  // a record is being reassembled
+	bool resync;   // words are discarded up to the end of a record, after a broken sequence
+	uint32_t lost; // words discarded because they belong to broken records
+};
+
+// sensors embedding the ISPU, with the registers used to access its RAM (same table as the Nucleo firmware)
+struct ispu_host_device {
+	const char *name;
+	uint8_t n_dev_names;
+	const char *dev_names[ISPU_HOST_MAX_NAMES];
+	uint8_t n_i2c_addr;
+	uint8_t i2c_addr[2]; // 8-bit addresses, as in the datasheet
+	uint8_t spi;
+	uint8_t who_am_i;
+	uint8_t ram_access;
+	uint8_t ram_access_delay; // [ms]
+	uint8_t ram_addr;
+	uint8_t ram_data;
+	uint8_t n_discard; // bytes to discard when reading the RAM
+	uint8_t fifo_data_out; // FIFO_DATA_OUT_TAG register, 0 if the device has no FIFO
+};
+
+enum ispu_host_bus {
+	ISPU_HOST_I2C,
+	ISPU_HOST_SPI
+};
+
+// Bus used to access the registers of the sensor. The multiple reads and writes access consecutive registers, except
+// for the RAM data register, which is written and read repeatedly. The functions return 0 on success, -1 on error.
+struct ispu_host_transport {
+	enum ispu_host_bus bus;
+	void *ctx;
+	int (*set_i2c_addr)(void *ctx, uint8_t addr); // 8-bit address, I2C only
+	int (*read)(void *ctx, uint8_t reg, uint8_t *buf, uint32_t len);
+	int (*write)(void *ctx, uint8_t reg, const uint8_t *buf, uint32_t len);
+	void (*close)(void *ctx);
+};
+
+struct ispu_host {
+	struct ispu_host_transport tr;
+	const struct ispu_host_device *dev;
+	int int_fd; // INT1 line requested from the GPIO character device, -1 to poll the interrupt status
+};
+
+// transports (spidev, i2c-dev, in-memory mock device in ispu_host_mock.h)
+int ispu_host_spidev_open(struct ispu_host_transport *tr, const char *path, uint32_t speed_hz);
+int ispu_host_i2cdev_open(struct ispu_host_transport *tr, const char *path);
+
+// device table
+const struct ispu_host_device *ispu_host_get_device(const char *sensor_name);
+const struct ispu_host_device *ispu_host_get_sensor_device(const struct ispu_host_sensor *sensor);
+
+void ispu_host_init(struct ispu_host *host, const struct ispu_host_transport *tr);
+void ispu_host_close(struct ispu_host *host);
+
+// looks for the device on the bus (its I2C addresses, or SPI), any device of the table if NULL, returns -1 if not found
+int ispu_host_detect(struct ispu_host *host, const struct ispu_host_device *dev);
+int ispu_host_reset(struct ispu_host *host); // software reset, followed by the settings needed by the device
+
+int ispu_host_read(struct ispu_host *host, uint8_t reg, uint8_t *val, uint32_t len);
+int ispu_host_write(struct ispu_host *host, uint8_t reg, uint8_t val);
+int ispu_host_write_mul(struct ispu_host *host, uint8_t reg, const uint8_t *val, uint32_t len);
+
+// access the ISPU RAM while the program is running (the ISPU clock is stopped during the access)
+int ispu_host_read_ram(struct ispu_host *host, uint32_t addr, uint8_t *buf, uint32_t len);
+int ispu_host_write_ram(struct ispu_host *host, uint32_t addr, const uint8_t *buf, uint32_t len);
+
+// loads a configuration, grouping the writes to the RAM data register in multiple writes
+int ispu_host_load_ops(struct ispu_host *host, const struct ispu_host_op *ops, uint32_t num_ops);
+
+// compares the ISPU RAM with the content written by a configuration, returns the number of bytes which differ
+int32_t ispu_host_verify_ops(struct ispu_host *host, const struct ispu_host_op *ops, uint32_t num_ops);
+
+// loads a program image generated by ispu_pack.py (or a patch generated by ispu_diff.py), returns the size of the
+// image (up to the end record) or -1 if invalid
+int32_t ispu_host_load_image(struct ispu_host *host, const uint8_t *image, uint32_t len);
+
+// interrupt of the algorithms on INT1: from the GPIO character device if opened, otherwise by polling the interrupt
+// status; returns 1 on interrupt, 0 on timeout, -1 on error (a negative timeout waits forever)
+int ispu_host_int_open(struct ispu_host *host, const char *chip_path, uint32_t line);
+int ispu_host_wait_int(struct ispu_host *host, int32_t timeout_ms);
+
+// reads the raw bytes of the output registers of a sensor, in the order of the outputs
+uint32_t ispu_host_outputs_size(const struct ispu_host_sensor *sensor);
+int ispu_host_read_outputs(struct ispu_host *host, const struct ispu_host_sensor *sensor, uint8_t *data);
+
+// formats the elements of an output as the test firmware prints them (tab-separated, labels between parenthesis)
+uint8_t ispu_host_type_size(uint8_t type);
+int ispu_host_format_output(const struct ispu_host_output *out, const uint8_t *data, bool labels, char *str,
+                            size_t size);
+
+// reads words (tag and data) from the FIFO in a single transaction, the register address wrapping around from the last
+// data register to the tag register; on the watermark interrupt, at least the watermark number of words is available
+int ispu_host_read_fifo(struct ispu_host *host, uint8_t *buf, uint32_t num_words);
+
+// reassembles the records from the FIFO words, returns true when a record is complete (in parser->rec)
+void ispu_host_fifo_parser_init(struct ispu_host_fifo_parser *parser);
+bool ispu_host_fifo_parse(struct ispu_host_fifo_parser *parser, const uint8_t *word);
+
+// configurations generated by ispu_gen (.h or .json), outputs described by the meta.txt file of the ISPU project
+int ispu_host_conf_load(const char *path, struct ispu_host_conf *conf);
+int ispu_host_conf_load_meta(const char *path, struct ispu_host_sensor *sensor);
+void ispu_host_conf_free(struct ispu_host_conf *conf);
+
+#endif
@@ -0,0 +1,47 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#ifndef ISPU_HOST_MOCK_H
+#define ISPU_HOST_MOCK_H
+
+#include <stdint.h>
+
+#include "ispu_host.h"
+
+// size of the emulated ISPU RAM, the addresses wrap around
+#define ISPU_HOST_MOCK_RAM_SIZE 0x80000u
+
+// words of the emulated FIFO, the oldest words are overwritten when full (continuous mode)
+#define ISPU_HOST_MOCK_FIFO_SIZE 512u
+
+// In-memory model of the registers of a sensor, to run the library without hardware (for example, in continuous
+// integration): register pages, WHO_AM_I, software reset, RAM access through the address and data registers, and
+// interrupt status. The ISPU does not execute the program: the outputs and the interrupts are set by the caller.
+int ispu_host_mock_open(struct ispu_host_transport *tr, const struct ispu_host_device *dev, enum ispu_host_bus bus);
+
+// content of the emulated RAM and registers (page 0 for the main page, 1 for the ISPU page)
+uint8_t *ispu_host_mock_ram(const struct ispu_host_transport *tr);
+uint8_t *ispu_host_mock_regs(const struct ispu_host_transport *tr, uint8_t page);
+
+// writes the output registers of the ISPU and latches the interrupt status, as the program does at the end of a
+// sample; the status is cleared when read
+void ispu_host_mock_set_outputs(const struct ispu_host_transport *tr, uint8_t reg_addr, const uint8_t *data,
+                                uint32_t len);
+void ispu_host_mock_raise_int(const struct ispu_host_transport *tr, uint32_t status);
+
+// writes a word (tag and data, ISPU_HOST_FIFO_WORD_LEN bytes) to the FIFO, as the program does through ISPU2FIFO_FLAG;
+// returns the number of words in the FIFO
+uint32_t ispu_host_mock_push_fifo(const struct ispu_host_transport *tr, const uint8_t *word);
+
+#endif
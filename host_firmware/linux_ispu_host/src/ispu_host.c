@@ -0,0 +1,837 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/gpio.h>
+
+#include "ispu_host.h"
+
+#define DETECT_TIMEOUT_MS 100
+#define POLL_TIMEOUT_MS 1000
+#define INT_POLL_PERIOD_MS 1
+
+// records of the program image generated by ispu_pack.py (and of the patch generated by ispu_diff.py)
+#define IMAGE_VERSION 1
+#define IMAGE_MAX_BURST 4096
+#define IMAGE_OP_END 0x00
+#define IMAGE_OP_WRITE 0x01
+#define IMAGE_OP_DELAY 0x02
+#define IMAGE_OP_POLL_SET 0x03
+#define IMAGE_OP_POLL_RESET 0x04
+#define IMAGE_OP_READ 0x05
+#define IMAGE_OP_BURST 0x06
+#define IMAGE_OP_BURST_LZ 0x07
+#define IMAGE_OP_RAM 0x08
+#define IMAGE_OP_RAM_LZ 0x09
+
+static const struct ispu_host_device devices[] = {
+	{ // ISM330IS and LSM6DSO16IS
+		.name = "imu22",
+		.n_dev_names = 2,
+		.dev_names = { "ISM330IS", "LSM6DSO16IS" },
+		.n_i2c_addr = 2,
+		.i2c_addr = { 0xD4, 0xD6 },
+		.spi = 1,
+		.who_am_i = 0x22,
+		.ram_access = 0x80,
+		.ram_access_delay = 0,
+		.ram_addr = 0x08,
+		.ram_data = 0x0B,
+		.n_discard = 1,
+		.fifo_data_out = 0
+	},
+	{ // IIS3DWB10IS
+		.name = "acc50",
+		.n_dev_names = 1,
+		.dev_names = { "IIS3DWB10IS" },
+		.n_i2c_addr = 0,
+		.i2c_addr = { 0 },
+		.spi = 1,
+		.who_am_i = 0x50,
+		.ram_access = 0xC0,
+		.ram_access_delay = 2,
+		.ram_addr = 0x07,
+		.ram_data = 0x0A,
+		.n_discard = 2,
+		.fifo_data_out = 0x40
+	}
+};
+
+static void delay_ms(uint32_t ms);
+static uint64_t get_tick(void);
+static int poll_reg(struct ispu_host *host, uint8_t reg, uint8_t mask, bool set);
+static int verify_segment(struct ispu_host *host, uint32_t addr, const uint8_t *expected, uint32_t len);
+static uint32_t expand(const uint8_t *src, uint32_t src_len, uint8_t *dst, uint32_t dst_len);
+static float half_to_float(uint16_t half);
+static int wait_gpio(int fd, int32_t timeout_ms);
+
+const struct ispu_host_device *ispu_host_get_device(const char *sensor_name)
+{
+	for (uint8_t i = 0; i < sizeof(devices) / sizeof(devices[0]); i++) {
+		for (uint8_t j = 0; j < devices[i].n_dev_names; j++) {
+			if (strcasecmp(sensor_name, devices[i].dev_names[j]) == 0)
+				return &devices[i];
+		}
+	}
+
+	return NULL;
+}
+
+const struct ispu_host_device *ispu_host_get_sensor_device(const struct ispu_host_sensor *sensor)
+{
+	for (uint8_t i = 0; i < sensor->num_names; i++) {
+		const struct ispu_host_device *dev = ispu_host_get_device(sensor->names[i]);
+		if (dev != NULL)
+			return dev;
+	}
+
+	return NULL;
+}
+
+void ispu_host_init(struct ispu_host *host, const struct ispu_host_transport *tr)
+{
+	host->tr = *tr;
+	host->dev = NULL;
+	host->int_fd = -1;
+}
+
+int ispu_host_detect(struct ispu_host *host, const struct ispu_host_device *dev)
+{
+	for (uint8_t i = 0; i < sizeof(devices) / sizeof(devices[0]); i++) {
+		const struct ispu_host_device *cand = &devices[i];
+		if (dev != NULL && dev != cand)
+			continue;
+
+		uint8_t n_addr = host->tr.bus == ISPU_HOST_I2C ? cand->n_i2c_addr : (cand->spi ? 1 : 0);
+
+		for (uint8_t j = 0; j < n_addr; j++) {
+			if (host->tr.bus == ISPU_HOST_I2C && host->tr.set_i2c_addr(host->tr.ctx, cand->i2c_addr[j]) != 0)
+				continue;
+
+			uint8_t who_am_i = 0x00;
+			uint64_t start = get_tick();
+			do {
+				// the sensor may not acknowledge the first accesses after power-up
+				if (ispu_host_write(host, 0x01, 0x00) == 0) // set default registers access
+					ispu_host_read(host, 0x0F, &who_am_i, 1);
+				if (who_am_i == cand->who_am_i)
+					break;
+				delay_ms(1);
+			} while (get_tick() - start <= DETECT_TIMEOUT_MS);
+
+			if (who_am_i == cand->who_am_i) {
+				host->dev = cand;
+				return 0;
+			}
+		}
+	}
+
+	return -1;
+}
+
+int ispu_host_reset(struct ispu_host *host)
+{
+	uint8_t tmp;
+
+	if (ispu_host_read(host, 0x12, &tmp, 1) != 0 || ispu_host_write(host, 0x12, tmp | 0x01) != 0)
+		return -1;
+	if (poll_reg(host, 0x12, 0x01, false) != 0)
+		return -1;
+
+	delay_ms(2);
+
+	// IIS3DWB10IS
+	if (host->dev->who_am_i == 0x50) {
+		ispu_host_write(host, 0x02, 0x0C); // pull-down disabled on INT pins + lower IO pins strength (for 3.3 V)
+		ispu_host_write(host, 0x03, 0x00); // INT pins in push-pull mode
+	}
+
+	return 0;
+}
+
+int ispu_host_read(struct ispu_host *host, uint8_t reg, uint8_t *val, uint32_t len)
+{
+	return host->tr.read(host->tr.ctx, reg, val, len);
+}
+
+int ispu_host_write(struct ispu_host *host, uint8_t reg, uint8_t val)
+{
+	return host->tr.write(host->tr.ctx, reg, &val, 1);
+}
+
+int ispu_host_write_mul(struct ispu_host *host, uint8_t reg, const uint8_t *val, uint32_t len)
+{
+	return host->tr.write(host->tr.ctx, reg, val, len);
+}
+
+int ispu_host_read_ram(struct ispu_host *host, uint32_t addr, uint8_t *buf, uint32_t len)
+{
+	const struct ispu_host_device *dev = host->dev;
+	uint8_t saved_page = 0x00, saved_clock = 0x01;
+	uint8_t port = dev->ram_data;
+	uint32_t start = addr;
+	int ret = 0;
+
+	// the RAM is read by 16-bit words: the odd addresses are read from the second data register where available,
+	// otherwise the read starts from the previous byte, which is then discarded
+	if (addr % 2 != 0) {
+		if (dev->n_discard == 2)
+			port = dev->ram_data + 1;
+		else
+			start = addr - 1;
+	}
+
+	ret |= ispu_host_read(host, 0x01, &saved_page, 1);
+	ret |= ispu_host_write(host, 0x01, dev->ram_access);
+
+	delay_ms(dev->ram_access_delay);
+
+	ret |= ispu_host_read(host, 0x02, &saved_clock, 1);
+	ret |= ispu_host_write(host, 0x02, 0x03); // disable the clock
+
+	ret |= ispu_host_write(host, dev->ram_addr, ((start >> 16) & 0xFF) | 0x40); // set read mode and ram address
+	ret |= ispu_host_write(host, dev->ram_addr + 1, (start >> 8) & 0xFF); // set ram address
+	ret |= ispu_host_write(host, dev->ram_addr + 2, start & 0xFF); // set ram address
+
+	uint8_t discard[8];
+	ret |= ispu_host_read(host, dev->ram_data, discard, dev->n_discard); // discard bad bytes
+	if (start != addr)
+		ret |= ispu_host_read(host, port, discard, 1);
+
+	ret |= ispu_host_read(host, port, buf, len);
+
+	ret |= ispu_host_write(host, 0x02, saved_clock);
+	ret |= ispu_host_write(host, 0x01, saved_page);
+
+	return ret != 0 ? -1 : 0;
+}
+
+int ispu_host_write_ram(struct ispu_host *host, uint32_t addr, const uint8_t *buf, uint32_t len)
+{
+	const struct ispu_host_device *dev = host->dev;
+	uint8_t saved_page = 0x00, saved_clock = 0x01;
+	int ret = 0;
+
+	ret |= ispu_host_read(host, 0x01, &saved_page, 1);
+	ret |= ispu_host_write(host, 0x01, dev->ram_access);
+
+	delay_ms(dev->ram_access_delay);
+
+	ret |= ispu_host_read(host, 0x02, &saved_clock, 1);
+	ret |= ispu_host_write(host, 0x02, 0x03); // disable the clock
+
+	ret |= ispu_host_write(host, dev->ram_addr, (addr >> 16) & 0xFF); // set write mode and ram address
+	ret |= ispu_host_write(host, dev->ram_addr + 1, (addr >> 8) & 0xFF); // set ram address
+	ret |= ispu_host_write(host, dev->ram_addr + 2, addr & 0xFF); // set ram address
+
+	ret |= ispu_host_write_mul(host, dev->ram_data, buf, len);
+
+	ret |= ispu_host_write(host, 0x02, saved_clock);
+	ret |= ispu_host_write(host, 0x01, saved_page);
+
+	return ret != 0 ? -1 : 0;
+}
+
+int ispu_host_load_ops(struct ispu_host *host, const struct ispu_host_op *ops, uint32_t num_ops)
+{
+	uint8_t *mem_buf = malloc(num_ops > 0 ? num_ops : 1);
+	if (mem_buf == NULL)
+		return -1;
+
+	uint32_t mem_i = 0;
+	uint8_t ispu_page = 0;
+	int ret = 0;
+
+	for (uint32_t j = 0; j < num_ops && ret == 0; j++) {
+		uint8_t is_mem_write = ops[j].type == ISPU_HOST_OP_WRITE && ispu_page && ops[j].address == host->dev->ram_data;
+
+		if (is_mem_write) {
+			mem_buf[mem_i++] = ops[j].data;
+			continue;
+		}
+
+		if (mem_i > 0) {
+			ret = ispu_host_write_mul(host, host->dev->ram_data, mem_buf, mem_i);
+			mem_i = 0;
+			if (ret != 0)
+				break;
+		}
+
+		uint8_t val;
+
+		switch (ops[j].type) {
+		case ISPU_HOST_OP_READ:
+			ret = ispu_host_read(host, ops[j].address, &val, 1);
+			break;
+		case ISPU_HOST_OP_WRITE:
+			if (ops[j].address == 0x01)
+				ispu_page = (ops[j].data & 0x80) != 0;
+			ret = ispu_host_write(host, ops[j].address, ops[j].data);
+			break;
+		case ISPU_HOST_OP_DELAY:
+			delay_ms(ops[j].data);
+			break;
+		case ISPU_HOST_OP_POLL_SET:
+		case ISPU_HOST_OP_POLL_RESET:
+			ret = poll_reg(host, ops[j].address, ops[j].data, ops[j].type == ISPU_HOST_OP_POLL_SET);
+			break;
+		default:
+			ret = -1;
+			break;
+		}
+	}
+
+	if (ret == 0 && mem_i > 0)
+		ret = ispu_host_write_mul(host, host->dev->ram_data, mem_buf, mem_i);
+
+	free(mem_buf);
+
+	return ret;
+}
+
+// The RAM content is rebuilt from the writes to the RAM address and data registers in the ISPU page, as done by
+// ispu_diff.py, and read back one segment (sequence of data writes after setting the address) at a time.
+int32_t ispu_host_verify_ops(struct ispu_host *host, const struct ispu_host_op *ops, uint32_t num_ops)
+{
+	const struct ispu_host_device *dev = host->dev;
+	uint8_t *expected = malloc(num_ops > 0 ? num_ops : 1);
+	if (expected == NULL)
+		return -1;
+
+	uint8_t address[3] = { 0 };
+	uint8_t ispu_page = 0;
+	uint32_t seg_addr = 0, seg_len = 0;
+	int32_t diff = 0;
+
+	for (uint32_t j = 0; j <= num_ops && diff >= 0; j++) {
+		uint8_t is_addr_write = 0, is_mem_write = 0;
+
+		if (j < num_ops && ops[j].type == ISPU_HOST_OP_WRITE) {
+			if (ops[j].address == 0x01)
+				ispu_page = (ops[j].data & 0x80) != 0;
+			is_addr_write = ispu_page && ops[j].address >= dev->ram_addr && ops[j].address < dev->ram_addr + 3;
+			is_mem_write = ispu_page && ops[j].address == dev->ram_data;
+		}
+
+		if (is_mem_write) {
+			expected[seg_len++] = ops[j].data;
+			continue;
+		}
+
+		if ((is_addr_write || j == num_ops) && seg_len > 0) {
+			int32_t seg_diff = verify_segment(host, seg_addr, expected, seg_len);
+			diff = seg_diff < 0 ? -1 : diff + seg_diff;
+			seg_addr += seg_len;
+			seg_len = 0;
+		}
+
+		if (is_addr_write) {
+			address[ops[j].address - dev->ram_addr] = ops[j].data;
+			seg_addr = ((uint32_t)address[0] << 16) | ((uint32_t)address[1] << 8) | address[2];
+		}
+	}
+
+	free(expected);
+
+	return diff;
+}
+
+int32_t ispu_host_load_image(struct ispu_host *host, const uint8_t *image, uint32_t len)
+{
+	static uint8_t burst_buf[IMAGE_MAX_BURST];
+
+	if (len < 5 || memcmp(image, "ISPU", 4) != 0 || image[4] != IMAGE_VERSION)
+		return -1;
+
+	uint32_t i = 5;
+
+	while (i < len) {
+		uint8_t op = image[i++];
+		uint32_t n, packed_n, addr;
+		uint8_t val;
+		int ret = 0;
+
+		// all records except the end one have at least one parameter
+		if (op != IMAGE_OP_END && i >= len)
+			return -1;
+
+		switch (op) {
+		case IMAGE_OP_END:
+			return (int32_t)i;
+		case IMAGE_OP_WRITE:
+			if (i + 2 > len)
+				return -1;
+			ret = ispu_host_write(host, image[i], image[i + 1]);
+			i += 2;
+			break;
+		case IMAGE_OP_DELAY:
+			delay_ms(image[i]);
+			i += 1;
+			break;
+		case IMAGE_OP_POLL_SET:
+		case IMAGE_OP_POLL_RESET:
+			if (i + 2 > len)
+				return -1;
+			ret = poll_reg(host, image[i], image[i + 1], op == IMAGE_OP_POLL_SET);
+			i += 2;
+			break;
+		case IMAGE_OP_READ:
+			ret = ispu_host_read(host, image[i], &val, 1);
+			i += 1;
+			break;
+		case IMAGE_OP_BURST:
+			if (i + 3 > len)
+				return -1;
+			n = image[i + 1] | (image[i + 2] << 8);
+			if (i + 3 + n > len)
+				return -1;
+			ret = ispu_host_write_mul(host, image[i], &image[i + 3], n);
+			i += 3 + n;
+			break;
+		case IMAGE_OP_BURST_LZ:
+			if (i + 5 > len)
+				return -1;
+			n = image[i + 1] | (image[i + 2] << 8);
+			packed_n = image[i + 3] | (image[i + 4] << 8);
+			if (i + 5 + packed_n > len || n > sizeof(burst_buf))
+				return -1;
+			if (expand(&image[i + 5], packed_n, burst_buf, n) != n)
+				return -1;
+			ret = ispu_host_write_mul(host, image[i], burst_buf, n);
+			i += 5 + packed_n;
+			break;
+		case IMAGE_OP_RAM:
+			if (i + 5 > len)
+				return -1;
+			addr = image[i] | (image[i + 1] << 8) | (image[i + 2] << 16);
+			n = image[i + 3] | (image[i + 4] << 8);
+			if (i + 5 + n > len)
+				return -1;
+			ret = ispu_host_write_ram(host, addr, &image[i + 5], n);
+			i += 5 + n;
+			break;
+		case IMAGE_OP_RAM_LZ:
+			if (i + 7 > len)
+				return -1;
+			addr = image[i] | (image[i + 1] << 8) | (image[i + 2] << 16);
+			n = image[i + 3] | (image[i + 4] << 8);
+			packed_n = image[i + 5] | (image[i + 6] << 8);
+			if (i + 7 + packed_n > len || n > sizeof(burst_buf))
+				return -1;
+			if (expand(&image[i + 7], packed_n, burst_buf, n) != n)
+				return -1;
+			ret = ispu_host_write_ram(host, addr, burst_buf, n);
+			i += 7 + packed_n;
+			break;
+		default:
+			return -1;
+		}
+
+		if (ret != 0)
+			return -1;
+	}
+
+	return -1; // end record missing
+}
+
+// The line is requested with the GPIO character device uAPI v2, with events on the rising edges (INT1 is active
+// high, as set by the configurations generated by ispu_gen).
+int ispu_host_int_open(struct ispu_host *host, const char *chip_path, uint32_t line)
+{
+	int fd = open(chip_path, O_RDONLY | O_CLOEXEC);
+	if (fd < 0)
+		return -1;
+
+	struct gpio_v2_line_request req;
+	memset(&req, 0, sizeof(req));
+	req.offsets[0] = line;
+	req.num_lines = 1;
+	req.config.flags = GPIO_V2_LINE_FLAG_INPUT | GPIO_V2_LINE_FLAG_EDGE_RISING;
+	snprintf(req.consumer, sizeof(req.consumer), "ispu_host");
+
+	int ret = ioctl(fd, GPIO_V2_GET_LINE_IOCTL, &req);
+	close(fd);
+	if (ret < 0)
+		return -1;
+
+	if (host->int_fd >= 0)
+		close(host->int_fd);
+	host->int_fd = req.fd;
+
+	return 0;
+}
+
+int ispu_host_wait_int(struct ispu_host *host, int32_t timeout_ms)
+{
+	uint8_t ispu_int_status[4];
+
+	if (host->int_fd >= 0) {
+		int ret = wait_gpio(host->int_fd, timeout_ms);
+		if (ret <= 0)
+			return ret;
+
+		// read ispu int status to clear interrupt if latched
+		return ispu_host_read(host, 0x1A, ispu_int_status, 4) == 0 ? 1 : -1;
+	}
+
+	uint64_t start = get_tick();
+
+	while (1) {
+		if (ispu_host_read(host, 0x1A, ispu_int_status, 4) != 0)
+			return -1;
+		if (ispu_int_status[0] | ispu_int_status[1] | ispu_int_status[2] | ispu_int_status[3])
+			return 1;
+		if (timeout_ms >= 0 && get_tick() - start >= (uint64_t)timeout_ms)
+			return 0;
+		delay_ms(INT_POLL_PERIOD_MS);
+	}
+}
+
+uint32_t ispu_host_outputs_size(const struct ispu_host_sensor *sensor)
+{
+	uint32_t size = 0;
+
+	for (uint16_t j = 0; j < sensor->num_outputs; j++)
+		size += sensor->outputs[j].len * ispu_host_type_size(sensor->outputs[j].type);
+
+	return size;
+}
+
+int ispu_host_read_outputs(struct ispu_host *host, const struct ispu_host_sensor *sensor, uint8_t *data)
+{
+	int ret = ispu_host_write(host, 0x01, 0x80);
+
+	// the raw bytes of the output registers, as they are laid out by the ISPU
+	for (uint16_t j = 0; j < sensor->num_outputs && ret == 0; j++) {
+		const struct ispu_host_output *out = &sensor->outputs[j];
+		uint32_t size = out->len * ispu_host_type_size(out->type);
+
+		ret = ispu_host_read(host, out->reg_addr, data, size);
+		data += size;
+	}
+
+	if (ispu_host_write(host, 0x01, 0x00) != 0)
+		ret = -1;
+
+	return ret;
+}
+
+int ispu_host_read_fifo(struct ispu_host *host, uint8_t *buf, uint32_t num_words)
+{
+	if (host->dev->fifo_data_out == 0)
+		return -1;
+
+	return ispu_host_read(host, host->dev->fifo_data_out, buf, num_words * ISPU_HOST_FIFO_WORD_LEN);
+}
+
+void ispu_host_fifo_parser_init(struct ispu_host_fifo_parser *parser)
+{
+	memset(parser, 0, sizeof(*parser));
+}
+
+bool ispu_host_fifo_parse(struct ispu_host_fifo_parser *parser, const uint8_t *word)
+{
+	uint8_t type = word[0] & 0x1F;
+	uint8_t left = word[0] >> 5;
+
+	// the word following the last word of a record starts a new record, the words of the records broken by the
+	// overflow of the FIFO are discarded
+	if (parser->pending && (type != parser->rec.type || left != parser->left - 1)) {
+		parser->lost += parser->rec.len / (ISPU_HOST_FIFO_WORD_LEN - 1);
+		parser->pending = false;
+		parser->resync = true;
+	}
+
+	if (parser->resync) {
+		parser->lost++;
+		parser->resync = left != 0;
+		return false;
+	}
+
+	if (!parser->pending) {
+		parser->rec.type = type;
+		parser->rec.len = 0;
+		parser->pending = true;
+	}
+
+	memcpy(&parser->rec.data[parser->rec.len], &word[1], ISPU_HOST_FIFO_WORD_LEN - 1);
+	parser->rec.len += ISPU_HOST_FIFO_WORD_LEN - 1;
+	parser->left = left;
+
+	if (left != 0)
+		return false;
+
+	parser->pending = false;
+
+	return true;
+}
+
+uint8_t ispu_host_type_size(uint8_t type)
+{
+	const struct {
+		uint8_t id;
+		uint8_t size;
+	} types[] = {
+		{ ISPU_HOST_TYPE_UINT8_T,  1 },
+		{ ISPU_HOST_TYPE_INT8_T,   1 },
+		{ ISPU_HOST_TYPE_CHAR,     1 },
+		{ ISPU_HOST_TYPE_UINT16_T, 2 },
+		{ ISPU_HOST_TYPE_INT16_T,  2 },
+		{ ISPU_HOST_TYPE_UINT32_T, 4 },
+		{ ISPU_HOST_TYPE_INT32_T,  4 },
+		{ ISPU_HOST_TYPE_UINT64_T, 8 },
+		{ ISPU_HOST_TYPE_INT64_T,  8 },
+		{ ISPU_HOST_TYPE_HALF,     2 },
+		{ ISPU_HOST_TYPE_FLOAT,    4 },
+		{ ISPU_HOST_TYPE_DOUBLE,   8 }
+	};
+
+	for (uint8_t i = 0; i < sizeof(types) / sizeof(types[0]); i++) {
+		if (type == types[i].id)
+			return types[i].size;
+	}
+
+	return 0;
+}
+
+// The values are little endian, as the host processors this library runs on, so they are copied as they are.
+int ispu_host_format_output(const struct ispu_host_output *out, const uint8_t *data, bool labels, char *str,
+                            size_t size)
+{
+	uint8_t type_size = ispu_host_type_size(out->type);
+	size_t n = 0;
+
+	if (size == 0)
+		return -1;
+	str[0] = '\0';
+
+	// char arrays are strings
+	if (out->type == ISPU_HOST_TYPE_CHAR) {
+		int len = (int)strnlen((const char *)data, out->len);
+		n = (size_t)snprintf(str, size, "%.*s", len, (const char *)data);
+		return n < size ? 0 : -1;
+	}
+
+	for (uint16_t k = 0; k < out->len && n < size; k++, data += type_size) {
+		union {
+			uint8_t u8;
+			int8_t i8;
+			uint16_t u16;
+			int16_t i16;
+			uint32_t u32;
+			int32_t i32;
+			uint64_t u64;
+			int64_t i64;
+			float f;
+			double d;
+		} value;
+		const char *sep = k > 0 ? "\t" : "";
+
+		memcpy(&value, data, type_size);
+
+		switch (out->type) {
+		case ISPU_HOST_TYPE_UINT8_T:
+			n += (size_t)snprintf(&str[n], size - n, "%s%u", sep, value.u8);
+			for (uint8_t l = 0; labels && l < out->num_results && n < size; l++) {
+				if (value.u8 == out->results[l].code)
+					n += (size_t)snprintf(&str[n], size - n, " (%s)", out->results[l].label);
+			}
+			break;
+		case ISPU_HOST_TYPE_INT8_T:
+			n += (size_t)snprintf(&str[n], size - n, "%s%d", sep, value.i8);
+			break;
+		case ISPU_HOST_TYPE_UINT16_T:
+			n += (size_t)snprintf(&str[n], size - n, "%s%u", sep, value.u16);
+			break;
+		case ISPU_HOST_TYPE_INT16_T:
+			n += (size_t)snprintf(&str[n], size - n, "%s%d", sep, value.i16);
+			break;
+		case ISPU_HOST_TYPE_UINT32_T:
+			n += (size_t)snprintf(&str[n], size - n, "%s%lu", sep, (unsigned long)value.u32);
+			break;
+		case ISPU_HOST_TYPE_INT32_T:
+			n += (size_t)snprintf(&str[n], size - n, "%s%ld", sep, (long)value.i32);
+			break;
+		case ISPU_HOST_TYPE_UINT64_T:
+			n += (size_t)snprintf(&str[n], size - n, "%s%llu", sep, (unsigned long long)value.u64);
+			break;
+		case ISPU_HOST_TYPE_INT64_T:
+			n += (size_t)snprintf(&str[n], size - n, "%s%lld", sep, (long long)value.i64);
+			break;
+		case ISPU_HOST_TYPE_HALF:
+			n += (size_t)snprintf(&str[n], size - n, "%s%f", sep, (double)half_to_float(value.u16));
+			break;
+		case ISPU_HOST_TYPE_FLOAT:
+			n += (size_t)snprintf(&str[n], size - n, "%s%f", sep, (double)value.f);
+			break;
+		case ISPU_HOST_TYPE_DOUBLE:
+			n += (size_t)snprintf(&str[n], size - n, "%s%f", sep, value.d);
+			break;
+		default:
+			return -1;
+		}
+	}
+
+	return n < size ? 0 : -1;
+}
+
+void ispu_host_close(struct ispu_host *host)
+{
+	if (host->int_fd >= 0)
+		close(host->int_fd);
+	host->int_fd = -1;
+
+	if (host->tr.close != NULL)
+		host->tr.close(host->tr.ctx);
+}
+
+static void delay_ms(uint32_t ms)
+{
+	struct timespec ts = { .tv_sec = ms / 1000, .tv_nsec = (long)(ms % 1000) * 1000000L };
+
+	while (nanosleep(&ts, &ts) != 0)
+		;
+}
+
+static uint64_t get_tick(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (uint64_t)ts.tv_sec * 1000u + (uint64_t)ts.tv_nsec / 1000000u;
+}
+
+// unlike the Nucleo firmware, the poll gives up after POLL_TIMEOUT_MS, so that a missing device does not hang the host
+static int poll_reg(struct ispu_host *host, uint8_t reg, uint8_t mask, bool set)
+{
+	uint64_t start = get_tick();
+	uint8_t val;
+
+	do {
+		if (ispu_host_read(host, reg, &val, 1) != 0)
+			return -1;
+		val &= mask;
+		if (set ? val == mask : val == 0)
+			return 0;
+	} while (get_tick() - start <= POLL_TIMEOUT_MS);
+
+	return -1;
+}
+
+static int verify_segment(struct ispu_host *host, uint32_t addr, const uint8_t *expected, uint32_t len)
+{
+	uint8_t *buf = malloc(len);
+	int32_t diff = 0;
+
+	if (buf == NULL || ispu_host_read_ram(host, addr, buf, len) != 0) {
+		free(buf);
+		return -1;
+	}
+
+	for (uint32_t i = 0; i < len; i++) {
+		if (buf[i] != expected[i])
+			diff++;
+	}
+
+	free(buf);
+
+	return diff;
+}
+
+static uint32_t expand(const uint8_t *src, uint32_t src_len, uint8_t *dst, uint32_t dst_len)
+{
+	uint32_t i = 0;
+	uint32_t o = 0;
+
+	while (i < src_len) {
+		uint8_t token = src[i++];
+
+		if (token < 0x80) { // literal bytes
+			uint32_t n = token + 1u;
+			if (i + n > src_len || o + n > dst_len)
+				return 0;
+			memcpy(&dst[o], &src[i], n);
+			i += n;
+			o += n;
+		} else { // copy of previous bytes, possibly overlapping the ones being written
+			if (i + 2 > src_len)
+				return 0;
+			uint32_t dist = src[i] | (src[i + 1] << 8);
+			uint32_t n = (token & 0x7Fu) + 3u;
+			i += 2;
+			if (dist == 0 || dist > o || o + n > dst_len)
+				return 0;
+			for (uint32_t k = 0; k < n; k++, o++)
+				dst[o] = dst[o - dist];
+		}
+	}
+
+	return o;
+}
+
+static int wait_gpio(int fd, int32_t timeout_ms)
+{
+	struct pollfd pfd = { .fd = fd, .events = POLLIN };
+
+	int ret = poll(&pfd, 1, timeout_ms < 0 ? -1 : (int)timeout_ms);
+	if (ret <= 0)
+		return ret;
+
+	// the events queued while the outputs were being read are consumed together
+	struct gpio_v2_line_event events[16];
+	if (read(fd, events, sizeof(events)) < (ssize_t)sizeof(events[0]))
+		return -1;
+
+	return 1;
+}
+
+// the host compiler may not support __fp16, so the half precision values are converted explicitly
+static float half_to_float(uint16_t half)
+{
+	uint32_t sign = (uint32_t)(half >> 15) << 31;
+	uint32_t exp = (half >> 10) & 0x1F;
+	uint32_t mant = half & 0x3FF;
+	uint32_t bits;
+
+	if (exp == 0x1F) { // infinity, NaN
+		bits = sign | 0x7F800000u | (mant << 13);
+	} else if (exp != 0) {
+		bits = sign | ((exp + 112u) << 23) | (mant << 13);
+	} else if (mant == 0) {
+		bits = sign;
+	} else { // subnormal, normalized in single precision
+		exp = 113;
+		while ((mant & 0x400) == 0) {
+			mant <<= 1;
+			exp--;
+		}
+		bits = sign | (exp << 23) | ((mant & 0x3FF) << 13);
+	}
+
+	float f;
+	memcpy(&f, &bits, sizeof(f));
+
+	return f;
+}
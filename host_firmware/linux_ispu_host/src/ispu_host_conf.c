@@ -0,0 +1,856 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <ctype.h>
+
+#include "ispu_host.h"
+
+#define LINE_LEN 1024u
+#define VALUE_LEN 256u
+#define JSON_MAX_DEPTH 32u
+
+enum json_type {
+	JSON_NULL,
+	JSON_BOOL,
+	JSON_NUMBER,
+	JSON_STRING,
+	JSON_ARRAY,
+	JSON_OBJECT
+};
+
+// node of the JSON document: the members of objects and the elements of arrays are linked lists of children
+struct json {
+	enum json_type type;
+	char *key;
+	char *str; // string value, or text of numbers and literals
+	struct json *child;
+	struct json *next;
+};
+
+struct json_parser {
+	const char *p;
+	const char *err;
+};
+
+static const struct {
+	const char *name;
+	uint8_t type;
+} types[] = {
+	{ "uint8_t", ISPU_HOST_TYPE_UINT8_T }, { "int8_t", ISPU_HOST_TYPE_INT8_T }, { "char", ISPU_HOST_TYPE_CHAR },
+	{ "uint16_t", ISPU_HOST_TYPE_UINT16_T }, { "int16_t", ISPU_HOST_TYPE_INT16_T },
+	{ "uint32_t", ISPU_HOST_TYPE_UINT32_T }, { "int32_t", ISPU_HOST_TYPE_INT32_T },
+	{ "uint64_t", ISPU_HOST_TYPE_UINT64_T }, { "int64_t", ISPU_HOST_TYPE_INT64_T },
+	{ "half", ISPU_HOST_TYPE_HALF }, { "float", ISPU_HOST_TYPE_FLOAT }, { "double", ISPU_HOST_TYPE_DOUBLE },
+};
+
+static const struct {
+	const char *name;
+	uint8_t type;
+} op_types[] = {
+	{ "read", ISPU_HOST_OP_READ }, { "write", ISPU_HOST_OP_WRITE }, { "delay", ISPU_HOST_OP_DELAY },
+	{ "poll_set", ISPU_HOST_OP_POLL_SET }, { "poll_reset", ISPU_HOST_OP_POLL_RESET },
+};
+
+static char *read_file(const char *path);
+static uint8_t get_type(const char *name);
+static uint8_t get_op_type(const char *name);
+static int load_json(const char *src, struct ispu_host_conf *conf, const char **err);
+static int load_h(const char *src, struct ispu_host_conf *conf, const char **err);
+static struct json *json_parse(const char *src, const char **err);
+static struct json *json_value(struct json_parser *ps, uint32_t depth);
+static char *json_string(struct json_parser *ps);
+static void json_skip_ws(struct json_parser *ps);
+static const struct json *json_get(const struct json *obj, const char *key);
+static const char *json_str(const struct json *obj, const char *key, const char *def);
+static uint32_t json_count(const struct json *arr);
+static void json_free(struct json *node);
+static const char *h_array(const char *src, const char *type, const char *name, const char **end);
+static const char *h_field(const char *start, const char *end, const char *field, char *val, size_t size);
+static const char *h_entry(const char *p, const char *end, const char **entry_end);
+static void free_sensor(struct ispu_host_sensor *sensor);
+
+int ispu_host_conf_load(const char *path, struct ispu_host_conf *conf)
+{
+	const char *err = NULL;
+	size_t len = strlen(path);
+
+	memset(conf, 0, sizeof(*conf));
+
+	char *src = read_file(path);
+	if (src == NULL) {
+		fprintf(stderr, "%s: cannot read the file\n", path);
+		return -1;
+	}
+
+	int ret;
+	if (len > 5 && strcmp(&path[len - 5], ".json") == 0)
+		ret = load_json(src, conf, &err);
+	else
+		ret = load_h(src, conf, &err);
+
+	free(src);
+
+	if (ret == 0 && conf->num_sensors == 0) {
+		err = "no sensors";
+		ret = -1;
+	}
+
+	if (ret != 0) {
+		fprintf(stderr, "%s: %s\n", path, err != NULL ? err : "out of memory");
+		ispu_host_conf_free(conf);
+	}
+
+	return ret;
+}
+
+// The outputs are laid out by ispu_gen one after the other from ISPU_DOUT_00_L, in the order of meta.txt, which only
+// contains their name, type, and length (optional, 1 if missing), followed by the labels of the values, if any:
+//
+//   output "Wake-up" uint8_t
+//   	0="inactive"
+int ispu_host_conf_load_meta(const char *path, struct ispu_host_sensor *sensor)
+{
+	FILE *f = fopen(path, "r");
+	if (f == NULL) {
+		fprintf(stderr, "%s: cannot read the file\n", path);
+		return -1;
+	}
+
+	struct ispu_host_output *outputs = NULL;
+	uint16_t num_outputs = 0;
+	uint32_t reg_addr = ISPU_HOST_DOUT_00;
+	const char *err = NULL;
+	char line[LINE_LEN];
+
+	while (err == NULL && fgets(line, sizeof(line), f) != NULL) {
+		char *p = line;
+		while (isspace((unsigned char)*p))
+			p++;
+
+		if (strncmp(p, "output", 6) == 0) {
+			char *name = strchr(p, '"');
+			char *name_end = name != NULL ? strchr(name + 1, '"') : NULL;
+			char type[32];
+			unsigned int count = 1;
+
+			if (name_end == NULL || sscanf(name_end + 1, "%31s %u", type, &count) < 1) {
+				err = "invalid output line";
+				break;
+			}
+
+			struct ispu_host_output *tmp = realloc(outputs, (num_outputs + 1u) * sizeof(*outputs));
+			if (tmp == NULL) {
+				err = "out of memory";
+				break;
+			}
+			outputs = tmp;
+
+			struct ispu_host_output *out = &outputs[num_outputs++];
+			memset(out, 0, sizeof(*out));
+			*name_end = '\0';
+			out->name = strdup(name + 1);
+			out->type = get_type(type);
+			out->len = (uint16_t)count;
+			out->reg_addr = (uint8_t)reg_addr;
+
+			if (out->type == 0)
+				err = "unsupported output type";
+			else if (out->name == NULL)
+				err = "out of memory";
+
+			reg_addr += count * ispu_host_type_size(out->type);
+			if (err == NULL && reg_addr > 0x100)
+				err = "outputs exceed the output registers";
+		} else if (isdigit((unsigned char)*p) && num_outputs > 0) {
+			struct ispu_host_output *out = &outputs[num_outputs - 1];
+			char *label = strchr(p, '"');
+			char *label_end = label != NULL ? strchr(label + 1, '"') : NULL;
+
+			if (label_end == NULL) {
+				err = "invalid label line";
+				break;
+			}
+
+			struct ispu_host_result *tmp = realloc(out->results, (out->num_results + 1u) * sizeof(*tmp));
+			if (tmp == NULL) {
+				err = "out of memory";
+				break;
+			}
+			out->results = tmp;
+
+			*label_end = '\0';
+			out->results[out->num_results].code = (uint8_t)strtoul(p, NULL, 0);
+			out->results[out->num_results].label = strdup(label + 1);
+			if (out->results[out->num_results++].label == NULL)
+				err = "out of memory";
+		}
+	}
+
+	fclose(f);
+
+	struct ispu_host_sensor meta = { .num_outputs = num_outputs, .outputs = outputs };
+
+	if (err != NULL) {
+		fprintf(stderr, "%s: %s\n", path, err);
+		free_sensor(&meta);
+		return -1;
+	}
+
+	// the outputs of the configuration are replaced
+	free_sensor(&(struct ispu_host_sensor){ .num_outputs = sensor->num_outputs, .outputs = sensor->outputs });
+	sensor->num_outputs = num_outputs;
+	sensor->outputs = outputs;
+
+	return 0;
+}
+
+void ispu_host_conf_free(struct ispu_host_conf *conf)
+{
+	for (uint32_t i = 0; i < conf->num_sensors; i++)
+		free_sensor(&conf->sensors[i]);
+
+	free(conf->sensors);
+	conf->sensors = NULL;
+	conf->num_sensors = 0;
+}
+
+static char *read_file(const char *path)
+{
+	FILE *f = fopen(path, "rb");
+	if (f == NULL)
+		return NULL;
+
+	char *buf = NULL;
+	long size = -1;
+
+	if (fseek(f, 0, SEEK_END) == 0)
+		size = ftell(f);
+	if (size >= 0 && fseek(f, 0, SEEK_SET) == 0)
+		buf = malloc((size_t)size + 1u);
+
+	if (buf != NULL && fread(buf, 1, (size_t)size, f) == (size_t)size) {
+		buf[size] = '\0';
+	} else {
+		free(buf);
+		buf = NULL;
+	}
+
+	fclose(f);
+
+	return buf;
+}
+
+static uint8_t get_type(const char *name)
+{
+	for (uint8_t i = 0; i < sizeof(types) / sizeof(types[0]); i++) {
+		if (strcasecmp(name, types[i].name) == 0)
+			return types[i].type;
+	}
+
+	return 0;
+}
+
+static uint8_t get_op_type(const char *name)
+{
+	for (uint8_t i = 0; i < sizeof(op_types) / sizeof(op_types[0]); i++) {
+		if (strcasecmp(name, op_types[i].name) == 0)
+			return op_types[i].type;
+	}
+
+	return 0;
+}
+
+static int load_json(const char *src, struct ispu_host_conf *conf, const char **err)
+{
+	struct json *root = json_parse(src, err);
+	if (root == NULL)
+		return -1;
+
+	const struct json *sensors = json_get(root, "sensors");
+	if (sensors == NULL || sensors->type != JSON_ARRAY) {
+		*err = "sensors not found";
+		json_free(root);
+		return -1;
+	}
+
+	conf->sensors = calloc(json_count(sensors) + 1u, sizeof(*conf->sensors));
+	if (conf->sensors == NULL) {
+		json_free(root);
+		return -1;
+	}
+
+	int ret = 0;
+
+	for (const struct json *s = sensors->child; s != NULL && ret == 0; s = s->next) {
+		struct ispu_host_sensor *sensor = &conf->sensors[conf->num_sensors++];
+		const struct json *names = json_get(s, "name");
+		const struct json *ops = json_get(s, "configuration");
+		const struct json *outputs = json_get(s, "outputs");
+
+		if (names != NULL && names->type == JSON_STRING) {
+			sensor->names[sensor->num_names++] = strdup(names->str);
+		} else if (names != NULL && names->type == JSON_ARRAY) {
+			for (const struct json *n = names->child; n != NULL && sensor->num_names < ISPU_HOST_MAX_NAMES; n = n->next)
+				sensor->names[sensor->num_names++] = n->str != NULL ? strdup(n->str) : NULL;
+		}
+
+		if (ops == NULL || ops->type != JSON_ARRAY) {
+			*err = "configuration not found";
+			ret = -1;
+			break;
+		}
+
+		sensor->ops = calloc(json_count(ops) + 1u, sizeof(*sensor->ops));
+		if (sensor->ops == NULL) {
+			ret = -1;
+			break;
+		}
+
+		for (const struct json *op = ops->child; op != NULL; op = op->next) {
+			const char *type = json_str(op, "type", NULL);
+			if (type == NULL) // comment
+				continue;
+
+			struct ispu_host_op *o = &sensor->ops[sensor->num_ops++];
+			o->type = get_op_type(type);
+			o->address = (uint8_t)strtoul(json_str(op, "address", "0"), NULL, 0);
+			o->data = (uint8_t)strtoul(json_str(op, "data", "0"), NULL, 0);
+
+			if (o->type == 0) {
+				*err = "unknown operation type";
+				ret = -1;
+				break;
+			}
+		}
+
+		if (ret != 0 || outputs == NULL || outputs->type != JSON_ARRAY)
+			continue;
+
+		sensor->outputs = calloc(json_count(outputs) + 1u, sizeof(*sensor->outputs));
+		if (sensor->outputs == NULL) {
+			ret = -1;
+			break;
+		}
+
+		for (const struct json *out = outputs->child; out != NULL && ret == 0; out = out->next) {
+			struct ispu_host_output *o = &sensor->outputs[sensor->num_outputs++];
+			const struct json *results = json_get(out, "results");
+
+			o->name = strdup(json_str(out, "name", ""));
+			o->type = get_type(json_str(out, "type", ""));
+			o->len = (uint16_t)strtoul(json_str(out, "len", "1"), NULL, 0);
+			o->reg_addr = (uint8_t)strtoul(json_str(out, "reg_addr", "0"), NULL, 0);
+
+			if (o->type == 0) {
+				*err = "unsupported output type";
+				ret = -1;
+				break;
+			}
+
+			if (results == NULL || results->type != JSON_ARRAY || results->child == NULL)
+				continue;
+
+			o->results = calloc(json_count(results), sizeof(*o->results));
+			if (o->results == NULL) {
+				ret = -1;
+				break;
+			}
+
+			for (const struct json *r = results->child; r != NULL; r = r->next) {
+				o->results[o->num_results].code = (uint8_t)strtoul(json_str(r, "code", "0"), NULL, 0);
+				o->results[o->num_results++].label = strdup(json_str(r, "label", ""));
+			}
+		}
+	}
+
+	json_free(root);
+
+	return ret;
+}
+
+// The arrays of the C header file are found by their names, as done by the Python tools: <prefix>_confs lists the
+// configuration of each sensor, <prefix>_names_N its names, and <prefix>_output_lists its outputs.
+static int load_h(const char *src, struct ispu_host_conf *conf, const char **err)
+{
+	const char *p = strstr(src, "static const struct mems_conf_op_list ");
+	char prefix[VALUE_LEN / 2], name[VALUE_LEN], val[VALUE_LEN];
+	const char *end, *outs_end = NULL;
+
+	if (p == NULL || sscanf(p, "static const struct mems_conf_op_list %100[A-Za-z0-9_]", prefix) != 1 ||
+	    strlen(prefix) < 6 || strcmp(&prefix[strlen(prefix) - 6], "_confs") != 0) {
+		*err = "configuration list not found";
+		return -1;
+	}
+	prefix[strlen(prefix) - 6] = '\0';
+
+	snprintf(name, sizeof(name), "%s_confs", prefix);
+	const char *confs = h_array(src, "mems_conf_op_list", name, &end);
+	snprintf(name, sizeof(name), "%s_output_lists", prefix);
+	const char *outs = h_array(src, "mems_conf_output_list", name, &outs_end);
+	if (confs == NULL) {
+		*err = "configuration list not found";
+		return -1;
+	}
+
+	uint32_t num = 0;
+	for (const char *q = confs; (q = strstr(q, ".list = ")) != NULL && q < end; q++)
+		num++;
+
+	conf->sensors = calloc(num + 1u, sizeof(*conf->sensors));
+	if (conf->sensors == NULL)
+		return -1;
+
+	const char *next_conf = confs, *next_out = outs;
+
+	for (uint32_t i = 0; i < num; i++) {
+		struct ispu_host_sensor *sensor = &conf->sensors[conf->num_sensors++];
+		const char *list_end;
+
+		// names
+		snprintf(val, sizeof(val), "*const %s_names_%lu[] = {", prefix, (unsigned long)i);
+		const char *q = strstr(src, val);
+		const char *names_end = q != NULL ? strstr(q, "};") : NULL;
+		while (names_end != NULL && sensor->num_names < ISPU_HOST_MAX_NAMES) {
+			const char *s = strchr(q + 1, '"');
+			const char *e = s != NULL ? strchr(s + 1, '"') : NULL;
+			if (e == NULL || e > names_end)
+				break;
+			sensor->names[sensor->num_names++] = strndup(s + 1, (size_t)(e - s - 1));
+			q = e;
+		}
+
+		// operations
+		next_conf = h_field(next_conf, end, "list", val, sizeof(val));
+		const char *ops = next_conf != NULL ? h_array(src, "mems_conf_op", val, &list_end) : NULL;
+		if (ops == NULL) {
+			*err = "configuration not found";
+			return -1;
+		}
+
+		uint32_t num_ops = 0;
+		for (const char *q = ops; (q = strstr(q, ".type = ")) != NULL && q < list_end; q++)
+			num_ops++;
+
+		sensor->ops = calloc(num_ops + 1u, sizeof(*sensor->ops));
+		if (sensor->ops == NULL)
+			return -1;
+
+		for (const char *q = ops; (q = strstr(q, "{ .type = MEMS_CONF_OP_TYPE_")) != NULL && q < list_end; q++) {
+			char type[16];
+			unsigned int address, data;
+
+			if (sscanf(q, "{ .type = MEMS_CONF_OP_TYPE_%15[A-Z_], .address = %i, .data = %i }", type, &address,
+			           &data) != 3) {
+				*err = "invalid operation";
+				return -1;
+			}
+
+			struct ispu_host_op *o = &sensor->ops[sensor->num_ops++];
+			o->type = get_op_type(type);
+			o->address = (uint8_t)address;
+			o->data = (uint8_t)data;
+		}
+
+		// outputs (NULL list for sensors without outputs)
+		next_out = next_out != NULL ? h_field(next_out, outs_end, "list", val, sizeof(val)) : NULL;
+		const char *outputs = next_out != NULL ? h_array(src, "mems_conf_output", val, &list_end) : NULL;
+		if (outputs == NULL)
+			continue;
+
+		uint32_t num_outputs = 0;
+		for (const char *q = outputs; (q = strstr(q, ".reg_addr = ")) != NULL && q < list_end; q++)
+			num_outputs++;
+
+		sensor->outputs = calloc(num_outputs + 1u, sizeof(*sensor->outputs));
+		if (sensor->outputs == NULL)
+			return -1;
+
+		const char *entry_end;
+		for (const char *q = h_entry(outputs, list_end, &entry_end); q != NULL;
+		     q = h_entry(entry_end, list_end, &entry_end)) {
+			struct ispu_host_output *o = &sensor->outputs[sensor->num_outputs++];
+
+			if (h_field(q, entry_end, "name", val, sizeof(val)) == NULL || (o->name = strdup(val)) == NULL)
+				return -1;
+			if (h_field(q, entry_end, "type", val, sizeof(val)) != NULL &&
+			    strncmp(val, "MEMS_CONF_OUTPUT_TYPE_", 22) == 0)
+				o->type = get_type(&val[22]);
+			if (h_field(q, entry_end, "len", val, sizeof(val)) != NULL)
+				o->len = (uint16_t)strtoul(val, NULL, 0);
+			if (h_field(q, entry_end, "reg_addr", val, sizeof(val)) != NULL)
+				o->reg_addr = (uint8_t)strtoul(val, NULL, 0);
+
+			if (o->type == 0) {
+				*err = "unsupported output type";
+				return -1;
+			}
+
+			const char *results_end;
+			const char *results = h_field(q, entry_end, "results", val, sizeof(val)) != NULL ?
+			                      h_array(src, "mems_conf_result", val, &results_end) : NULL;
+
+			const char *r_end;
+			for (const char *r = results != NULL ? h_entry(results, results_end, &r_end) : NULL; r != NULL;
+			     r = h_entry(r_end, results_end, &r_end)) {
+				struct ispu_host_result *tmp = realloc(o->results, (o->num_results + 1u) * sizeof(*tmp));
+				if (tmp == NULL)
+					return -1;
+				o->results = tmp;
+
+				char label[VALUE_LEN];
+				if (h_field(r, r_end, "code", val, sizeof(val)) == NULL ||
+				    h_field(r, r_end, "label", label, sizeof(label)) == NULL) {
+					*err = "invalid result";
+					return -1;
+				}
+				o->results[o->num_results].code = (uint8_t)strtoul(val, NULL, 0);
+				o->results[o->num_results++].label = strdup(label);
+			}
+		}
+	}
+
+	return 0;
+}
+
+static struct json *json_parse(const char *src, const char **err)
+{
+	struct json_parser ps = { .p = src, .err = NULL };
+
+	struct json *root = json_value(&ps, 0);
+	json_skip_ws(&ps);
+
+	if (root != NULL && *ps.p != '\0') {
+		json_free(root);
+		root = NULL;
+		ps.err = "unexpected content after the JSON document";
+	}
+
+	if (root == NULL)
+		*err = ps.err != NULL ? ps.err : "invalid JSON document";
+
+	return root;
+}
+
+static struct json *json_value(struct json_parser *ps, uint32_t depth)
+{
+	json_skip_ws(ps);
+
+	if (depth > JSON_MAX_DEPTH) {
+		ps->err = "JSON document too deep";
+		return NULL;
+	}
+
+	struct json *node = calloc(1, sizeof(*node));
+	if (node == NULL)
+		return NULL;
+
+	char c = *ps->p;
+
+	if (c == '{' || c == '[') {
+		struct json **tail = &node->child;
+		char close = c == '{' ? '}' : ']';
+
+		node->type = c == '{' ? JSON_OBJECT : JSON_ARRAY;
+		ps->p++;
+		json_skip_ws(ps);
+
+		if (*ps->p == close) {
+			ps->p++;
+			return node;
+		}
+
+		while (1) {
+			char *key = NULL;
+
+			if (node->type == JSON_OBJECT) {
+				json_skip_ws(ps);
+				key = json_string(ps);
+				json_skip_ws(ps);
+				if (key == NULL || *ps->p != ':') {
+					free(key);
+					break;
+				}
+				ps->p++;
+			}
+
+			struct json *child = json_value(ps, depth + 1);
+			if (child == NULL) {
+				free(key);
+				break;
+			}
+			child->key = key;
+			*tail = child;
+			tail = &child->next;
+
+			json_skip_ws(ps);
+			if (*ps->p == ',') {
+				ps->p++;
+			} else if (*ps->p == close) {
+				ps->p++;
+				return node;
+			} else {
+				break;
+			}
+		}
+
+		if (ps->err == NULL)
+			ps->err = "invalid JSON object or array";
+		json_free(node);
+		return NULL;
+	}
+
+	if (c == '"') {
+		node->type = JSON_STRING;
+		node->str = json_string(ps);
+	} else if (c == '-' || isdigit((unsigned char)c) || isalpha((unsigned char)c)) {
+		const char *start = ps->p;
+		while (*ps->p == '-' || *ps->p == '+' || *ps->p == '.' || isalnum((unsigned char)*ps->p))
+			ps->p++;
+		node->str = strndup(start, (size_t)(ps->p - start));
+		if (node->str != NULL && strcmp(node->str, "null") == 0)
+			node->type = JSON_NULL;
+		else if (node->str != NULL && (strcmp(node->str, "true") == 0 || strcmp(node->str, "false") == 0))
+			node->type = JSON_BOOL;
+		else
+			node->type = JSON_NUMBER;
+	}
+
+	if (node->str == NULL) {
+		if (ps->err == NULL)
+			ps->err = "invalid JSON value";
+		json_free(node);
+		return NULL;
+	}
+
+	return node;
+}
+
+// the escape sequences are decoded, except for the characters out of the ASCII range, replaced by '?'
+static char *json_string(struct json_parser *ps)
+{
+	if (*ps->p != '"')
+		return NULL;
+
+	const char *start = ++ps->p;
+	while (*ps->p != '"' && *ps->p != '\0')
+		ps->p += (*ps->p == '\\' && ps->p[1] != '\0') ? 2 : 1;
+
+	if (*ps->p != '"') {
+		ps->err = "unterminated JSON string";
+		return NULL;
+	}
+
+	char *str = malloc((size_t)(ps->p - start) + 1u);
+	if (str == NULL)
+		return NULL;
+
+	size_t n = 0;
+	for (const char *q = start; q < ps->p; q++) {
+		if (*q != '\\') {
+			str[n++] = *q;
+			continue;
+		}
+
+		switch (*++q) {
+		case 'n':
+			str[n++] = '\n';
+			break;
+		case 't':
+			str[n++] = '\t';
+			break;
+		case 'r':
+			str[n++] = '\r';
+			break;
+		case 'b':
+			str[n++] = '\b';
+			break;
+		case 'f':
+			str[n++] = '\f';
+			break;
+		case 'u': {
+			char hex[5] = { 0 };
+			strncpy(hex, q + 1, 4);
+			unsigned long code = strtoul(hex, NULL, 16);
+			str[n++] = code < 0x80 ? (char)code : '?';
+			q += strlen(hex);
+			break;
+		}
+		default:
+			str[n++] = *q;
+			break;
+		}
+	}
+	str[n] = '\0';
+	ps->p++;
+
+	return str;
+}
+
+static void json_skip_ws(struct json_parser *ps)
+{
+	while (isspace((unsigned char)*ps->p))
+		ps->p++;
+}
+
+static const struct json *json_get(const struct json *obj, const char *key)
+{
+	if (obj == NULL || obj->type != JSON_OBJECT)
+		return NULL;
+
+	for (const struct json *c = obj->child; c != NULL; c = c->next) {
+		if (strcmp(c->key, key) == 0)
+			return c;
+	}
+
+	return NULL;
+}
+
+static const char *json_str(const struct json *obj, const char *key, const char *def)
+{
+	const struct json *val = json_get(obj, key);
+
+	return val != NULL && val->str != NULL ? val->str : def;
+}
+
+static uint32_t json_count(const struct json *arr)
+{
+	uint32_t n = 0;
+
+	for (const struct json *c = arr->child; c != NULL; c = c->next)
+		n++;
+
+	return n;
+}
+
+static void json_free(struct json *node)
+{
+	// the siblings are freed iteratively, since the lists of operations are long
+	while (node != NULL) {
+		struct json *next = node->next;
+		json_free(node->child);
+		free(node->key);
+		free(node->str);
+		free(node);
+		node = next;
+	}
+}
+
+// returns the content of the initializer of the array, up to the closing brace (*end)
+static const char *h_array(const char *src, const char *type, const char *name, const char **end)
+{
+	char decl[VALUE_LEN * 2];
+	snprintf(decl, sizeof(decl), "struct %s %s[", type, name);
+
+	const char *p = strstr(src, decl);
+	if (p == NULL || (p = strstr(p, "= {")) == NULL || (*end = strstr(p, "\n};")) == NULL)
+		return NULL;
+
+	return p + 3;
+}
+
+// Copies the value of the designated initializer .field, without the quotes if it is a string, and returns the
+// position after it. Only the first value found between start and end is considered.
+static const char *h_field(const char *start, const char *end, const char *field, char *val, size_t size)
+{
+	char key[64];
+	snprintf(key, sizeof(key), ".%s = ", field);
+
+	const char *p = strstr(start, key);
+	if (p == NULL || p >= end)
+		return NULL;
+	p += strlen(key);
+
+	size_t n = 0;
+	if (*p == '"') {
+		for (p++; *p != '"' && *p != '\0'; p++) {
+			if (*p == '\\' && p[1] != '\0')
+				p++;
+			if (n + 1 < size)
+				val[n++] = *p;
+		}
+		if (*p == '"')
+			p++;
+	} else {
+		for (; isalnum((unsigned char)*p) || *p == '_'; p++) {
+			if (n + 1 < size)
+				val[n++] = *p;
+		}
+	}
+	val[n] = '\0';
+
+	return p;
+}
+
+// returns the next initializer between braces, skipping the braces within strings
+static const char *h_entry(const char *p, const char *end, const char **entry_end)
+{
+	while (p < end && *p != '{') {
+		if (*p == '"') {
+			for (p++; p < end && *p != '"'; p++) {
+				if (*p == '\\')
+					p++;
+			}
+		}
+		p++;
+	}
+
+	if (p >= end)
+		return NULL;
+
+	const char *start = p++;
+	uint32_t depth = 1;
+
+	for (; p < end && depth > 0; p++) {
+		if (*p == '"') {
+			for (p++; p < end && *p != '"'; p++) {
+				if (*p == '\\')
+					p++;
+			}
+		} else if (*p == '{') {
+			depth++;
+		} else if (*p == '}') {
+			depth--;
+		}
+	}
+
+	if (depth > 0)
+		return NULL;
+
+	*entry_end = p;
+
+	return start;
+}
+
+static void free_sensor(struct ispu_host_sensor *sensor)
+{
+	for (uint8_t i = 0; i < sensor->num_names; i++)
+		free(sensor->names[i]);
+
+	for (uint16_t j = 0; j < sensor->num_outputs; j++) {
+		for (uint8_t k = 0; k < sensor->outputs[j].num_results; k++)
+			free(sensor->outputs[j].results[k].label);
+		free(sensor->outputs[j].results);
+		free(sensor->outputs[j].name);
+	}
+
+	free(sensor->outputs);
+	free(sensor->ops);
+	memset(sensor, 0, sizeof(*sensor));
+}
@@ -0,0 +1,125 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/i2c.h>
+#include <linux/i2c-dev.h>
+
+#include "ispu_host.h"
+
+// the length of an I2C message is 16-bit, longer transfers are split in several messages: this is only needed for
+// the RAM data register, which keeps its position across them
+#define I2C_MAX_MSG 4096u
+
+struct i2cdev {
+	int fd;
+	uint16_t addr; // 7-bit address
+	uint8_t buf[I2C_MAX_MSG + 1u];
+};
+
+static int i2cdev_set_addr(void *ctx, uint8_t addr);
+static int i2cdev_read(void *ctx, uint8_t reg, uint8_t *buf, uint32_t len);
+static int i2cdev_write(void *ctx, uint8_t reg, const uint8_t *buf, uint32_t len);
+static void i2cdev_close(void *ctx);
+
+int ispu_host_i2cdev_open(struct ispu_host_transport *tr, const char *path)
+{
+	struct i2cdev *i2c = malloc(sizeof(*i2c));
+	if (i2c == NULL)
+		return -1;
+
+	i2c->addr = 0;
+	i2c->fd = open(path, O_RDWR | O_CLOEXEC);
+	if (i2c->fd < 0) {
+		free(i2c);
+		return -1;
+	}
+
+	memset(tr, 0, sizeof(*tr));
+	tr->bus = ISPU_HOST_I2C;
+	tr->ctx = i2c;
+	tr->set_i2c_addr = i2cdev_set_addr;
+	tr->read = i2cdev_read;
+	tr->write = i2cdev_write;
+	tr->close = i2cdev_close;
+
+	return 0;
+}
+
+static int i2cdev_set_addr(void *ctx, uint8_t addr)
+{
+	struct i2cdev *i2c = ctx;
+
+	i2c->addr = addr >> 1;
+
+	return 0;
+}
+
+// register address write followed by a repeated start and the read, as done by HAL_I2C_Mem_Read
+static int i2cdev_read(void *ctx, uint8_t reg, uint8_t *buf, uint32_t len)
+{
+	struct i2cdev *i2c = ctx;
+
+	while (len > 0) {
+		uint32_t n = len < I2C_MAX_MSG ? len : I2C_MAX_MSG;
+		struct i2c_msg msgs[2] = {
+			{ .addr = i2c->addr, .flags = 0, .len = 1, .buf = &reg },
+			{ .addr = i2c->addr, .flags = I2C_M_RD, .len = (uint16_t)n, .buf = buf }
+		};
+		struct i2c_rdwr_ioctl_data data = { .msgs = msgs, .nmsgs = 2 };
+
+		if (ioctl(i2c->fd, I2C_RDWR, &data) < 0)
+			return -1;
+
+		buf += n;
+		len -= n;
+	}
+
+	return 0;
+}
+
+static int i2cdev_write(void *ctx, uint8_t reg, const uint8_t *buf, uint32_t len)
+{
+	struct i2cdev *i2c = ctx;
+
+	while (len > 0) {
+		uint32_t n = len < I2C_MAX_MSG ? len : I2C_MAX_MSG;
+		struct i2c_msg msg = { .addr = i2c->addr, .flags = 0, .len = (uint16_t)(n + 1u), .buf = i2c->buf };
+		struct i2c_rdwr_ioctl_data data = { .msgs = &msg, .nmsgs = 1 };
+
+		i2c->buf[0] = reg;
+		memcpy(&i2c->buf[1], buf, n);
+
+		if (ioctl(i2c->fd, I2C_RDWR, &data) < 0)
+			return -1;
+
+		buf += n;
+		len -= n;
+	}
+
+	return 0;
+}
+
+static void i2cdev_close(void *ctx)
+{
+	struct i2cdev *i2c = ctx;
+
+	close(i2c->fd);
+	free(i2c);
+}
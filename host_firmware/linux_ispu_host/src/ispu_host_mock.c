@@ -0,0 +1,270 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ispu_host.h"
+#include "ispu_host_mock.h"
+
+#define PAGE_MAIN 0
+#define PAGE_ISPU 1
+
+#define REG_PAGE 0x01
+#define REG_WHO_AM_I 0x0F
+#define REG_CTRL3_C 0x12
+#define REG_INT_STATUS 0x1A
+
+struct mock {
+	const struct ispu_host_device *dev;
+	uint8_t i2c_addr;
+	uint8_t regs[2][256];
+	uint8_t ram[ISPU_HOST_MOCK_RAM_SIZE];
+	uint32_t ram_ptr;
+	uint8_t ram_discard; // bytes returned before the RAM content after setting the address in read mode
+	uint32_t int_status;
+	uint8_t fifo[ISPU_HOST_MOCK_FIFO_SIZE][ISPU_HOST_FIFO_WORD_LEN];
+	uint32_t fifo_head;
+	uint32_t fifo_count;
+};
+
+static int mock_set_addr(void *ctx, uint8_t addr);
+static int mock_read(void *ctx, uint8_t reg, uint8_t *buf, uint32_t len);
+static int mock_write(void *ctx, uint8_t reg, const uint8_t *buf, uint32_t len);
+static void mock_close(void *ctx);
+static uint8_t get_page(const struct mock *m);
+static bool is_ram_port(const struct mock *m, uint8_t reg);
+static bool is_fifo_port(const struct mock *m, uint8_t reg);
+static uint8_t read_reg(struct mock *m, uint8_t reg);
+static void write_reg(struct mock *m, uint8_t reg, uint8_t val);
+
+int ispu_host_mock_open(struct ispu_host_transport *tr, const struct ispu_host_device *dev, enum ispu_host_bus bus)
+{
+	if (dev == NULL || (bus == ISPU_HOST_I2C && dev->n_i2c_addr == 0) || (bus == ISPU_HOST_SPI && !dev->spi))
+		return -1;
+
+	struct mock *m = calloc(1, sizeof(*m));
+	if (m == NULL)
+		return -1;
+
+	m->dev = dev;
+	m->i2c_addr = bus == ISPU_HOST_I2C ? 0 : 0xFF;
+
+	memset(tr, 0, sizeof(*tr));
+	tr->bus = bus;
+	tr->ctx = m;
+	tr->set_i2c_addr = bus == ISPU_HOST_I2C ? mock_set_addr : NULL;
+	tr->read = mock_read;
+	tr->write = mock_write;
+	tr->close = mock_close;
+
+	return 0;
+}
+
+uint8_t *ispu_host_mock_ram(const struct ispu_host_transport *tr)
+{
+	struct mock *m = tr->ctx;
+
+	return m->ram;
+}
+
+uint8_t *ispu_host_mock_regs(const struct ispu_host_transport *tr, uint8_t page)
+{
+	struct mock *m = tr->ctx;
+
+	return m->regs[page != 0 ? PAGE_ISPU : PAGE_MAIN];
+}
+
+void ispu_host_mock_set_outputs(const struct ispu_host_transport *tr, uint8_t reg_addr, const uint8_t *data,
+                                uint32_t len)
+{
+	struct mock *m = tr->ctx;
+
+	for (uint32_t i = 0; i < len && reg_addr + i < 0x100; i++)
+		m->regs[PAGE_ISPU][reg_addr + i] = data[i];
+}
+
+void ispu_host_mock_raise_int(const struct ispu_host_transport *tr, uint32_t status)
+{
+	struct mock *m = tr->ctx;
+
+	m->int_status |= status;
+}
+
+uint32_t ispu_host_mock_push_fifo(const struct ispu_host_transport *tr, const uint8_t *word)
+{
+	struct mock *m = tr->ctx;
+
+	if (m->fifo_count == ISPU_HOST_MOCK_FIFO_SIZE) {
+		m->fifo_head = (m->fifo_head + 1) % ISPU_HOST_MOCK_FIFO_SIZE;
+		m->fifo_count--;
+	}
+
+	memcpy(m->fifo[(m->fifo_head + m->fifo_count) % ISPU_HOST_MOCK_FIFO_SIZE], word, ISPU_HOST_FIFO_WORD_LEN);
+	m->fifo_count++;
+
+	return m->fifo_count;
+}
+
+// the sensor answers on the first of its I2C addresses only, the others are not acknowledged
+static int mock_set_addr(void *ctx, uint8_t addr)
+{
+	struct mock *m = ctx;
+
+	m->i2c_addr = addr;
+
+	return 0;
+}
+
+static int mock_read(void *ctx, uint8_t reg, uint8_t *buf, uint32_t len)
+{
+	struct mock *m = ctx;
+
+	if (m->i2c_addr != 0xFF && m->i2c_addr != m->dev->i2c_addr[0])
+		return -1;
+
+	// consecutive registers, except for the RAM data port which streams the RAM content, and for the FIFO output
+	// registers, which wrap around to the tag register after the last data register
+	for (uint32_t i = 0; i < len; i++) {
+		buf[i] = read_reg(m, reg);
+		if (is_fifo_port(m, reg) && reg == m->dev->fifo_data_out + ISPU_HOST_FIFO_WORD_LEN - 1)
+			reg = m->dev->fifo_data_out;
+		else if (!is_ram_port(m, reg))
+			reg++;
+	}
+
+	return 0;
+}
+
+static int mock_write(void *ctx, uint8_t reg, const uint8_t *buf, uint32_t len)
+{
+	struct mock *m = ctx;
+
+	if (m->i2c_addr != 0xFF && m->i2c_addr != m->dev->i2c_addr[0])
+		return -1;
+
+	for (uint32_t i = 0; i < len; i++) {
+		write_reg(m, reg, buf[i]);
+		if (!is_ram_port(m, reg))
+			reg++;
+	}
+
+	return 0;
+}
+
+static void mock_close(void *ctx)
+{
+	free(ctx);
+}
+
+static uint8_t get_page(const struct mock *m)
+{
+	return (m->regs[PAGE_MAIN][REG_PAGE] & 0x80) != 0 ? PAGE_ISPU : PAGE_MAIN;
+}
+
+// the IIS3DWB10IS reads the odd addresses of the RAM from the register following the data register
+static bool is_ram_port(const struct mock *m, uint8_t reg)
+{
+	if (get_page(m) != PAGE_ISPU)
+		return false;
+
+	return reg == m->dev->ram_data || (m->dev->n_discard == 2 && reg == m->dev->ram_data + 1);
+}
+
+static bool is_fifo_port(const struct mock *m, uint8_t reg)
+{
+	uint8_t base = m->dev->fifo_data_out;
+
+	return base != 0 && get_page(m) == PAGE_MAIN && reg >= base && reg < base + ISPU_HOST_FIFO_WORD_LEN;
+}
+
+static uint8_t read_reg(struct mock *m, uint8_t reg)
+{
+	uint8_t page = get_page(m);
+
+	if (reg == REG_PAGE)
+		return m->regs[PAGE_MAIN][REG_PAGE];
+
+	if (page == PAGE_MAIN) {
+		if (reg == REG_WHO_AM_I)
+			return m->dev->who_am_i;
+
+		// latched interrupt status, cleared when read
+		if (reg >= REG_INT_STATUS && reg < REG_INT_STATUS + 4) {
+			uint8_t shift = (reg - REG_INT_STATUS) * 8;
+			uint8_t val = (m->int_status >> shift) & 0xFF;
+			m->int_status &= ~(0xFFu << shift);
+			return val;
+		}
+
+		// the word is removed from the FIFO when its last data register is read, an empty FIFO reads as zeros
+		if (is_fifo_port(m, reg)) {
+			uint8_t idx = reg - m->dev->fifo_data_out;
+			uint8_t val = m->fifo_count > 0 ? m->fifo[m->fifo_head][idx] : 0;
+			if (m->fifo_count > 0 && idx == ISPU_HOST_FIFO_WORD_LEN - 1) {
+				m->fifo_head = (m->fifo_head + 1) % ISPU_HOST_MOCK_FIFO_SIZE;
+				m->fifo_count--;
+			}
+			return val;
+		}
+	}
+
+	if (is_ram_port(m, reg)) {
+		if (m->ram_discard > 0) {
+			m->ram_discard--;
+			return 0xFF;
+		}
+		return m->ram[m->ram_ptr++ % ISPU_HOST_MOCK_RAM_SIZE];
+	}
+
+	return m->regs[page][reg];
+}
+
+static void write_reg(struct mock *m, uint8_t reg, uint8_t val)
+{
+	uint8_t page = get_page(m);
+	const struct ispu_host_device *dev = m->dev;
+
+	if (reg == REG_PAGE) {
+		m->regs[PAGE_MAIN][REG_PAGE] = val;
+		return;
+	}
+
+	// software reset: the registers go back to their default values, the bit is cleared when done
+	if (page == PAGE_MAIN && reg == REG_CTRL3_C && (val & 0x01) != 0) {
+		memset(m->regs, 0, sizeof(m->regs));
+		m->int_status = 0;
+		m->fifo_head = 0;
+		m->fifo_count = 0;
+		return;
+	}
+
+	if (page == PAGE_ISPU && reg >= dev->ram_addr && reg < dev->ram_addr + 3) {
+		m->regs[page][reg] = val;
+
+		const uint8_t *addr = &m->regs[PAGE_ISPU][dev->ram_addr];
+		m->ram_ptr = ((uint32_t)(addr[0] & 0x3F) << 16) | ((uint32_t)addr[1] << 8) | addr[2];
+		m->ram_discard = (addr[0] & 0x40) != 0 ? dev->n_discard : 0;
+		return;
+	}
+
+	if (is_ram_port(m, reg)) {
+		m->ram[m->ram_ptr++ % ISPU_HOST_MOCK_RAM_SIZE] = val;
+		return;
+	}
+
+	m->regs[page][reg] = val;
+}
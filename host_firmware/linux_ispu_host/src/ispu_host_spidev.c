@@ -0,0 +1,123 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <linux/spi/spidev.h>
+
+#include "ispu_host.h"
+
+// spidev limits the size of a message to its bufsiz parameter (4096 bytes by default), so longer transfers are split
+// in several messages: this is only needed for the RAM data register, which keeps its position across them
+#define SPIDEV_MAX_MSG 4096u
+
+struct spidev {
+	int fd;
+	uint32_t speed_hz;
+};
+
+static int spidev_read(void *ctx, uint8_t reg, uint8_t *buf, uint32_t len);
+static int spidev_write(void *ctx, uint8_t reg, const uint8_t *buf, uint32_t len);
+static int spidev_transfer(struct spidev *spi, uint8_t cmd, uint8_t *rx, const uint8_t *tx, uint32_t len);
+static void spidev_close(void *ctx);
+
+int ispu_host_spidev_open(struct ispu_host_transport *tr, const char *path, uint32_t speed_hz)
+{
+	struct spidev *spi = malloc(sizeof(*spi));
+	if (spi == NULL)
+		return -1;
+
+	uint8_t mode = SPI_MODE_3, bits = 8;
+
+	spi->speed_hz = speed_hz;
+	spi->fd = open(path, O_RDWR | O_CLOEXEC);
+	if (spi->fd < 0 || ioctl(spi->fd, SPI_IOC_WR_MODE, &mode) < 0 ||
+	    ioctl(spi->fd, SPI_IOC_WR_BITS_PER_WORD, &bits) < 0 ||
+	    ioctl(spi->fd, SPI_IOC_WR_MAX_SPEED_HZ, &spi->speed_hz) < 0) {
+		if (spi->fd >= 0)
+			close(spi->fd);
+		free(spi);
+		return -1;
+	}
+
+	memset(tr, 0, sizeof(*tr));
+	tr->bus = ISPU_HOST_SPI;
+	tr->ctx = spi;
+	tr->read = spidev_read;
+	tr->write = spidev_write;
+	tr->close = spidev_close;
+
+	return 0;
+}
+
+static int spidev_read(void *ctx, uint8_t reg, uint8_t *buf, uint32_t len)
+{
+	while (len > 0) {
+		uint32_t n = len < SPIDEV_MAX_MSG - 1u ? len : SPIDEV_MAX_MSG - 1u;
+
+		if (spidev_transfer(ctx, reg | 0x80, buf, NULL, n) != 0)
+			return -1;
+
+		buf += n;
+		len -= n;
+	}
+
+	return 0;
+}
+
+static int spidev_write(void *ctx, uint8_t reg, const uint8_t *buf, uint32_t len)
+{
+	while (len > 0) {
+		uint32_t n = len < SPIDEV_MAX_MSG - 1u ? len : SPIDEV_MAX_MSG - 1u;
+
+		if (spidev_transfer(ctx, reg, NULL, buf, n) != 0)
+			return -1;
+
+		buf += n;
+		len -= n;
+	}
+
+	return 0;
+}
+
+// the register address and the data are sent in one message, with chip select kept active between the transfers
+static int spidev_transfer(struct spidev *spi, uint8_t cmd, uint8_t *rx, const uint8_t *tx, uint32_t len)
+{
+	struct spi_ioc_transfer xfer[2];
+
+	memset(xfer, 0, sizeof(xfer));
+	xfer[0].tx_buf = (uintptr_t)&cmd;
+	xfer[0].len = 1;
+	xfer[0].speed_hz = spi->speed_hz;
+	xfer[0].bits_per_word = 8;
+	xfer[1].tx_buf = (uintptr_t)tx;
+	xfer[1].rx_buf = (uintptr_t)rx;
+	xfer[1].len = len;
+	xfer[1].speed_hz = spi->speed_hz;
+	xfer[1].bits_per_word = 8;
+
+	return ioctl(spi->fd, SPI_IOC_MESSAGE(2), xfer) < 0 ? -1 : 0;
+}
+
+static void spidev_close(void *ctx)
+{
+	struct spidev *spi = ctx;
+
+	close(spi->fd);
+	free(spi);
+}
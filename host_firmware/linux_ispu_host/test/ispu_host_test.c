@@ -0,0 +1,296 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "ispu_host.h"
+#include "ispu_host_mock.h"
+
+#define CHECK(cond) check((cond), #cond, __LINE__)
+
+static uint32_t failures;
+
+static void check(bool cond, const char *expr, int line);
+static int open_mock(struct ispu_host *host, struct ispu_host_transport *tr, const char *name, enum ispu_host_bus bus);
+static void test_ram(const char *name, enum ispu_host_bus bus);
+static void test_verify(const char *name, enum ispu_host_bus bus);
+static void test_outputs(void);
+static void fifo_word(uint8_t *word, uint8_t type, uint8_t left, uint8_t seq);
+static void test_fifo(void);
+
+int main(void)
+{
+	test_ram("ISM330IS", ISPU_HOST_I2C);
+	test_ram("ISM330IS", ISPU_HOST_SPI);
+	test_ram("IIS3DWB10IS", ISPU_HOST_SPI);
+	test_verify("ISM330IS", ISPU_HOST_I2C);
+	test_verify("IIS3DWB10IS", ISPU_HOST_SPI);
+	test_outputs();
+	test_fifo();
+
+	if (failures > 0) {
+		printf("%lu checks failed\n", (unsigned long)failures);
+		return 1;
+	}
+
+	printf("All checks passed\n");
+
+	return 0;
+}
+
+static void check(bool cond, const char *expr, int line)
+{
+	if (!cond) {
+		printf("%s:%d: check failed: %s\n", __FILE__, line, expr);
+		failures++;
+	}
+}
+
+static int open_mock(struct ispu_host *host, struct ispu_host_transport *tr, const char *name, enum ispu_host_bus bus)
+{
+	const struct ispu_host_device *dev = ispu_host_get_device(name);
+
+	if (dev == NULL || ispu_host_mock_open(tr, dev, bus) != 0)
+		return -1;
+
+	ispu_host_init(host, tr);
+
+	return ispu_host_detect(host, dev);
+}
+
+// reads and writes at even and odd addresses, with even and odd lengths, must access exactly the requested bytes
+static void test_ram(const char *name, enum ispu_host_bus bus)
+{
+	struct ispu_host_transport tr;
+	struct ispu_host host;
+
+	CHECK(open_mock(&host, &tr, name, bus) == 0);
+	if (host.dev == NULL)
+		return;
+
+	uint8_t *ram = ispu_host_mock_ram(&tr);
+	for (uint32_t i = 0; i < 0x200; i++)
+		ram[0x1000 + i] = (uint8_t)(i * 7 + 3);
+
+	for (uint32_t addr = 0x1000; addr < 0x1004; addr++) {
+		for (uint32_t len = 1; len <= 9; len++) {
+			uint8_t buf[16];
+
+			memset(buf, 0xAA, sizeof(buf));
+			CHECK(ispu_host_read_ram(&host, addr, buf, len) == 0);
+			CHECK(memcmp(buf, &ram[addr], len) == 0);
+			CHECK(buf[len] == 0xAA);
+		}
+	}
+
+	for (uint32_t addr = 0x1100; addr < 0x1104; addr++) {
+		uint8_t data[5] = { 0x11, 0x22, 0x33, 0x44, 0x55 };
+		uint8_t before = ram[addr - 1], after = ram[addr + sizeof(data)];
+		uint8_t buf[sizeof(data)];
+
+		CHECK(ispu_host_write_ram(&host, addr, data, sizeof(data)) == 0);
+		CHECK(memcmp(&ram[addr], data, sizeof(data)) == 0);
+		CHECK(ram[addr - 1] == before);
+		CHECK(ram[addr + sizeof(data)] == after);
+
+		CHECK(ispu_host_read_ram(&host, addr, buf, sizeof(buf)) == 0);
+		CHECK(memcmp(buf, data, sizeof(data)) == 0);
+	}
+
+	// the register page and the ISPU clock are restored after each access
+	CHECK(ispu_host_mock_regs(&tr, 0)[0x01] == 0x00);
+
+	ispu_host_close(&host);
+}
+
+// a configuration writing the RAM is read back without differences, a corrupted byte is reported
+static void test_verify(const char *name, enum ispu_host_bus bus)
+{
+	struct ispu_host_transport tr;
+	struct ispu_host host;
+
+	CHECK(open_mock(&host, &tr, name, bus) == 0);
+	if (host.dev == NULL)
+		return;
+
+	const struct ispu_host_device *dev = host.dev;
+	struct ispu_host_op ops[64];
+	uint32_t n = 0;
+
+	ops[n++] = (struct ispu_host_op){ ISPU_HOST_OP_WRITE, 0x01, dev->ram_access };
+	ops[n++] = (struct ispu_host_op){ ISPU_HOST_OP_WRITE, dev->ram_addr, 0x00 };
+	ops[n++] = (struct ispu_host_op){ ISPU_HOST_OP_WRITE, dev->ram_addr + 1, 0x20 };
+	ops[n++] = (struct ispu_host_op){ ISPU_HOST_OP_WRITE, dev->ram_addr + 2, 0x00 };
+	for (uint8_t i = 0; i < 21; i++)
+		ops[n++] = (struct ispu_host_op){ ISPU_HOST_OP_WRITE, dev->ram_data, (uint8_t)(0x40 + i) };
+	ops[n++] = (struct ispu_host_op){ ISPU_HOST_OP_WRITE, dev->ram_addr, 0x00 };
+	ops[n++] = (struct ispu_host_op){ ISPU_HOST_OP_WRITE, dev->ram_addr + 1, 0x30 };
+	ops[n++] = (struct ispu_host_op){ ISPU_HOST_OP_WRITE, dev->ram_addr + 2, 0x01 };
+	for (uint8_t i = 0; i < 7; i++)
+		ops[n++] = (struct ispu_host_op){ ISPU_HOST_OP_WRITE, dev->ram_data, (uint8_t)(0x80 + i) };
+	ops[n++] = (struct ispu_host_op){ ISPU_HOST_OP_WRITE, 0x01, 0x00 };
+
+	CHECK(ispu_host_load_ops(&host, ops, n) == 0);
+
+	uint8_t *ram = ispu_host_mock_ram(&tr);
+	CHECK(ram[0x2000] == 0x40 && ram[0x2014] == 0x54);
+	CHECK(ram[0x3001] == 0x80 && ram[0x3007] == 0x86);
+	CHECK(ispu_host_verify_ops(&host, ops, n) == 0);
+
+	ram[0x3003] ^= 0xFF;
+	CHECK(ispu_host_verify_ops(&host, ops, n) == 1);
+
+	ispu_host_close(&host);
+}
+
+// the outputs are read from the ISPU page and formatted as the test firmware prints them
+static void test_outputs(void)
+{
+	struct ispu_host_transport tr;
+	struct ispu_host host;
+
+	CHECK(open_mock(&host, &tr, "ISM330IS", ISPU_HOST_SPI) == 0);
+	if (host.dev == NULL)
+		return;
+
+	struct ispu_host_result results[] = { { 1, "walking" }, { 2, "running" } };
+	struct ispu_host_output outputs[] = {
+		{ "class", ISPU_HOST_TYPE_UINT8_T, 1, 0x10, 2, results },
+		{ "acc", ISPU_HOST_TYPE_INT16_T, 3, 0x11, 0, NULL },
+		{ "norm", ISPU_HOST_TYPE_FLOAT, 1, 0x17, 0, NULL },
+		{ "scale", ISPU_HOST_TYPE_HALF, 1, 0x1B, 0, NULL },
+		{ "name", ISPU_HOST_TYPE_CHAR, 4, 0x1D, 0, NULL },
+		{ "count", ISPU_HOST_TYPE_INT64_T, 1, 0x21, 0, NULL }
+	};
+	struct ispu_host_sensor sensor = { .num_outputs = 6, .outputs = outputs };
+	const uint8_t regs[] = {
+		0x02,
+		0xFE, 0xFF, 0x05, 0x00, 0x00, 0x80,
+		0x00, 0x00, 0xC0, 0x3F,
+		0x00, 0x3C,
+		'a', 'b', 'c', 0x00,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+	};
+
+	CHECK(ispu_host_outputs_size(&sensor) == sizeof(regs));
+
+	ispu_host_mock_set_outputs(&tr, 0x10, regs, sizeof(regs));
+
+	uint8_t data[sizeof(regs)];
+	CHECK(ispu_host_read_outputs(&host, &sensor, data) == 0);
+	CHECK(memcmp(data, regs, sizeof(regs)) == 0);
+	CHECK(ispu_host_mock_regs(&tr, 0)[0x01] == 0x00);
+
+	const char *expected[] = { "2 (running)", "-2\t5\t-32768", "1.500000", "1.000000", "abc", "-1" };
+	const uint8_t *p = data;
+	char str[64];
+
+	for (uint16_t j = 0; j < sensor.num_outputs; j++) {
+		CHECK(ispu_host_format_output(&outputs[j], p, true, str, sizeof(str)) == 0);
+		CHECK(strcmp(str, expected[j]) == 0);
+		p += outputs[j].len * ispu_host_type_size(outputs[j].type);
+	}
+
+	CHECK(ispu_host_format_output(&outputs[0], data, false, str, sizeof(str)) == 0);
+	CHECK(strcmp(str, "2") == 0);
+
+	ispu_host_close(&host);
+}
+
+static void fifo_word(uint8_t *word, uint8_t type, uint8_t left, uint8_t seq)
+{
+	memset(word, 0, ISPU_HOST_FIFO_WORD_LEN);
+	word[0] = (uint8_t)((left << 5) | type);
+	word[1] = seq;
+	word[2] = left;
+}
+
+// the records are reassembled from the FIFO words read in single transactions, and the broken records are discarded
+static void test_fifo(void)
+{
+	struct ispu_host_transport tr;
+	struct ispu_host host;
+	struct ispu_host_fifo_parser parser;
+	uint8_t words[8 * ISPU_HOST_FIFO_WORD_LEN];
+
+	CHECK(open_mock(&host, &tr, "IIS3DWB10IS", ISPU_HOST_SPI) == 0);
+	if (host.dev == NULL)
+		return;
+
+	// a record of one word has the type as tag, as the records written before the fifo_batch module
+	fifo_word(words, 1, 0, 0);
+	CHECK(words[0] == 0x01);
+
+	ispu_host_mock_push_fifo(&tr, words);
+	for (uint8_t k = 0; k < 3; k++) {
+		fifo_word(words, 2, 2 - k, 1);
+		ispu_host_mock_push_fifo(&tr, words);
+	}
+	fifo_word(words, 1, 0, 2);
+	CHECK(ispu_host_mock_push_fifo(&tr, words) == 5);
+
+	ispu_host_fifo_parser_init(&parser);
+
+	// the record of three words spans two reads
+	CHECK(ispu_host_read_fifo(&host, words, 2) == 0);
+	CHECK(ispu_host_fifo_parse(&parser, &words[0]));
+	CHECK(parser.rec.type == 1 && parser.rec.len == 9 && parser.rec.data[0] == 0);
+	CHECK(!ispu_host_fifo_parse(&parser, &words[ISPU_HOST_FIFO_WORD_LEN]));
+
+	CHECK(ispu_host_read_fifo(&host, words, 3) == 0);
+	CHECK(!ispu_host_fifo_parse(&parser, &words[0]));
+	CHECK(ispu_host_fifo_parse(&parser, &words[ISPU_HOST_FIFO_WORD_LEN]));
+	CHECK(parser.rec.type == 2 && parser.rec.len == 27);
+	CHECK(parser.rec.data[0] == 1 && parser.rec.data[1] == 2);
+	CHECK(parser.rec.data[9] == 1 && parser.rec.data[10] == 1);
+	CHECK(parser.rec.data[18] == 1 && parser.rec.data[19] == 0);
+	CHECK(ispu_host_fifo_parse(&parser, &words[2 * ISPU_HOST_FIFO_WORD_LEN]));
+	CHECK(parser.rec.type == 1 && parser.rec.data[0] == 2);
+	CHECK(parser.lost == 0);
+
+	// a record missing its middle word is discarded with the word breaking it, the next record is parsed
+	uint8_t *w = words;
+	fifo_word(w, 3, 2, 3);
+	w += ISPU_HOST_FIFO_WORD_LEN;
+	fifo_word(w, 3, 0, 3);
+	w += ISPU_HOST_FIFO_WORD_LEN;
+	fifo_word(w, 1, 0, 4);
+
+	CHECK(!ispu_host_fifo_parse(&parser, &words[0]));
+	CHECK(!ispu_host_fifo_parse(&parser, &words[ISPU_HOST_FIFO_WORD_LEN]));
+	CHECK(parser.lost == 2);
+	CHECK(ispu_host_fifo_parse(&parser, &words[2 * ISPU_HOST_FIFO_WORD_LEN]));
+	CHECK(parser.rec.type == 1 && parser.rec.data[0] == 4);
+
+	// the words of a record following a broken one are discarded up to the end of the record
+	w = words;
+	fifo_word(w, 2, 1, 5);
+	w += ISPU_HOST_FIFO_WORD_LEN;
+	fifo_word(w, 2, 1, 6);
+	w += ISPU_HOST_FIFO_WORD_LEN;
+	fifo_word(w, 2, 0, 6);
+	w += ISPU_HOST_FIFO_WORD_LEN;
+	fifo_word(w, 1, 0, 7);
+
+	for (uint8_t k = 0; k < 3; k++)
+		CHECK(!ispu_host_fifo_parse(&parser, &words[k * ISPU_HOST_FIFO_WORD_LEN]));
+	CHECK(parser.lost == 5);
+	CHECK(ispu_host_fifo_parse(&parser, &words[3 * ISPU_HOST_FIFO_WORD_LEN]));
+	CHECK(parser.rec.data[0] == 7);
+
+	ispu_host_close(&host);
+}
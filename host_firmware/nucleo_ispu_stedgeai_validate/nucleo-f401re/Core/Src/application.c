@@ -37,7 +37,11 @@
 #define STACK_ERROR 0x00000002
 #define UCF_VERSION_ERROR 0x00000004
 
-#define LAYERS_BUF_SIZE 256
+#define LAYERS_BUF_SIZE 512
+#define LAYERS_MAX 512
+
+#define INPUT_COPY_SIZE (1024 * 16)
+#define INPUT_SEGS_MAX 16
 
 static const uint8_t expected_ucf_version[2] = { 1, 2 };
 
@@ -72,6 +76,12 @@ static void write_ram(uint32_t addr, uint8_t *buf, uint32_t len);
 static void signal_ispu();
 static void wait_ispu();
 static void get_and_send_info();
+static void start_run(void);
+static void flush_layers(uint8_t print);
+static void save_input(uint32_t addr, const uint8_t *data, uint32_t len);
+static void restore_inputs(void);
+static void reset_stats(void);
+static uint32_t get_clock(void);
 
 static uint8_t stack_overflow();
 
@@ -114,14 +124,27 @@ static uint8_t ucf_mem_buf[BUF_SIZE / 2];
 static uint32_t input_idx;
 static uint32_t input_offset;
 
+// copy of the inputs written to the RAM, written again before each execution of the repeat command, since the input
+// buffers may be part of the activations and overwritten by the inference
+static uint8_t input_copy[INPUT_COPY_SIZE];
+static uint32_t input_seg_addr[INPUT_SEGS_MAX], input_seg_len[INPUT_SEGS_MAX];
+static uint32_t input_copy_len, input_segs;
+static uint8_t input_copy_lost;
+
 static volatile uint8_t enable_int;
 static volatile uint8_t ispu_int;
 static volatile uint8_t waiting_interrupt;
-static volatile uint32_t exec_time, layer_start, layer_time[LAYERS_BUF_SIZE];
+static volatile uint32_t exec_time, layer_start, layer_time[LAYERS_BUF_SIZE], layer_node[LAYERS_BUF_SIZE];
 static volatile uint16_t layer_next, layer_curr;
+static volatile uint32_t layer_count, layers_lost;
 static volatile uint8_t first_exec_int;
 static volatile GPIO_PinState prev_int2_state;
 
+// per-layer statistics of the executions since the last run or repeat command
+static uint32_t layer_min[LAYERS_MAX], layer_max[LAYERS_MAX], layer_sum[LAYERS_MAX], layer_runs[LAYERS_MAX];
+static uint32_t run_time, run_min, run_max, run_sum, run_count, layers_num;
+static uint32_t runs_left;
+
 static uint32_t timeout_boot = TIMEOUT_BOOT;
 static uint32_t timeout_run = TIMEOUT_RUN;
 
@@ -194,17 +217,7 @@ void application(void)
 
 				write(0x01, 0x00);
 			} else if (strcmp((char *)uart_buf, "clock") == 0) {
-				uint32_t freq = 0;
-
-				freq = 5000000;
-
-				uint8_t ctrl10 = 0;
-				read(0x19, &ctrl10, 1);
-
-				if (ctrl10 & 0x4)
-					freq = 10000000;
-
-				printf("%lu\n", freq);
+				printf("%lu\n", get_clock());
 			} else if (strcmp((char *)uart_buf, "macc") == 0) {
 				uint64_t macc = 0;
 
@@ -225,6 +238,39 @@ void application(void)
 				printf("%llu\n", macc);
 
 				write(0x01, 0x00);
+			} else if (strcmp((char *)uart_buf, "profile") == 0) {
+				// time of each layer of the executions since the last run or repeat command, in the order of the
+				// nodes (see get_nodes), the cycles are the ones of the mean time
+				uint32_t freq = get_clock();
+				uint32_t num = layers_num < LAYERS_MAX ? layers_num : LAYERS_MAX;
+
+				printf("ISPU clock: %lu Hz\n", freq);
+				printf("executions: %lu, layers: %lu, layer times lost: %lu\n", run_count, layers_num, layers_lost);
+				printf("layer\tmin [us]\tmean [us]\tmax [us]\tcycles\n");
+				for (uint32_t i = 0; i < num; i++) {
+					uint32_t mean = layer_runs[i] > 0 ? layer_sum[i] / layer_runs[i] : 0;
+					printf("%lu\t%lu\t%lu\t%lu\t%lu\n", i, layer_runs[i] > 0 ? layer_min[i] : 0, mean, layer_max[i],
+					       (uint32_t)((uint64_t)mean * freq / 1000000));
+				}
+				uint32_t mean = run_count > 0 ? run_sum / run_count : 0;
+				printf("total\t%lu\t%lu\t%lu\t%lu\n", run_count > 0 ? run_min : 0, mean, run_max,
+				       (uint32_t)((uint64_t)mean * freq / 1000000));
+			} else if (strncmp((char *)uart_buf, "repeat", 6) == 0) {
+				uint32_t n = 0;
+				sscanf((char *)uart_buf, "repeat%lu", &n);
+
+				if (n > 0 && input_copy_lost) {
+					printf("Inputs larger than %u bytes cannot be restored before each execution.\n",
+					       INPUT_COPY_SIZE);
+				} else if (n > 0) {
+					reset_stats();
+					runs_left = n;
+
+					printf("Requested %lu executions.\n", n);
+
+					restore_inputs();
+					start_run();
+				}
 			} else if (strcmp((char *)uart_buf, "blocksize") == 0) {
 				printf("%u\n", BUF_SIZE);
 			} else if (strncmp((char *)uart_buf, "timeout_boot", 12) == 0) {
@@ -361,22 +407,12 @@ void application(void)
 
 				write(0x01, 0x00);
 			} else if (strcmp((char *)uart_buf, "run") == 0) {
-				HAL_TIM_Base_Start(&htim5);
-
-				first_exec_int = 1;
-				prev_int2_state = GPIO_PIN_SET;
-				waiting_interrupt = 1;
-
-				layer_next = layer_curr = 0;
+				reset_stats();
+				runs_left = 0;
 
 				printf("Requested execution.\n");
 
-				write(0x01, 0x80);
-				write(0x0C, 0x01); // give run command to ISPU
-				write(0x01, 0x00);
-				write(0x18, dev->ispu_rate); // wake up the ISPU
-
-				__HAL_TIM_SET_COUNTER(&htim2, 0);
+				start_run();
 			}
 		}
 
@@ -429,6 +465,7 @@ void application(void)
 				inputs_addr += input_offset;
 
 				write_ram(inputs_addr, buf[buf_i_read], block_size_read[buf_i_read]);
+				save_input(inputs_addr, buf[buf_i_read], block_size_read[buf_i_read]);
 				input_offset += block_size_read[buf_i_read];
 
 				write(0x01, 0x00);
@@ -496,6 +533,10 @@ void application(void)
 			}
 		}
 
+		// the layer times are sent while the ISPU is running, so that the buffer does not overflow for deep networks
+		if (waiting_interrupt)
+			flush_layers(runs_left == 0);
+
 		if (ispu_int && !waiting_interrupt) {
 			ispu_int = 0; // ignore if interrupt arrives after timeout
 			write(0x18, 0x00); // turn off the ISPU
@@ -508,10 +549,15 @@ void application(void)
 
 			HAL_Delay(2);
 
-			while (layer_curr != layer_next) {
-				printf("%lu\n", layer_time[layer_curr]);
-				layer_curr = (layer_curr + 1) % LAYERS_BUF_SIZE;
-			}
+			flush_layers(runs_left == 0);
+
+			if (run_time < run_min)
+				run_min = run_time;
+			if (run_time > run_max)
+				run_max = run_time;
+			run_sum += run_time;
+			run_count++;
+			layers_num = layer_count;
 
 			write(0x18, 0x00); // turn off the ISPU
 			HAL_Delay(1); // make sure the ISPU is sleeping
@@ -520,6 +566,19 @@ void application(void)
 			if (stack_overflow())
 				return_code |= STACK_ERROR;
 
+			// repeated executions: the outputs are not read, the next execution is started
+			if (runs_left > 0 && return_code == 0) {
+				if (--runs_left > 0) {
+					restore_inputs();
+					start_run();
+				} else {
+					HAL_TIM_Base_Stop(&htim5);
+					printf("Completed %lu executions.\n", run_count);
+				}
+				continue;
+			}
+			runs_left = 0;
+
 			printf("ret 0x%lX\n", return_code);
 
 			if (return_code == 0) {
@@ -570,6 +629,11 @@ void application(void)
 			if (__HAL_TIM_GET_COUNTER(&htim2) > timeout_run) {
 				waiting_interrupt = 0;
 
+				// the times of the layers completed before the timeout must not be mixed with the next execution
+				flush_layers(runs_left == 0);
+				HAL_TIM_Base_Stop(&htim5);
+				runs_left = 0;
+
 				uint32_t return_code = TIMEOUT_ERROR;
 				if (stack_overflow())
 					return_code |= STACK_ERROR;
@@ -593,6 +657,115 @@ static void wait_ispu()
 	} while (tmp == 0x00);
 }
 
+static void start_run(void)
+{
+	HAL_TIM_Base_Start(&htim5);
+
+	first_exec_int = 1;
+	prev_int2_state = GPIO_PIN_SET;
+
+	layer_next = layer_curr = 0;
+	layer_count = 0;
+	run_time = 0;
+
+	waiting_interrupt = 1;
+
+	write(0x01, 0x80);
+	write(0x0C, 0x01); // give run command to ISPU
+	write(0x01, 0x00);
+	write(0x18, dev->ispu_rate); // wake up the ISPU
+
+	__HAL_TIM_SET_COUNTER(&htim2, 0);
+}
+
+// Empty the buffer of the layer times filled by the interrupt, printing them if requested, and add them to the
+// statistics of the layers.
+static void flush_layers(uint8_t print)
+{
+	while (layer_curr != layer_next) {
+		uint32_t time = layer_time[layer_curr];
+		uint32_t node = layer_node[layer_curr];
+		layer_curr = (layer_curr + 1) % LAYERS_BUF_SIZE;
+
+		if (print)
+			printf("%lu\n", time);
+
+		run_time += time;
+
+		if (node < LAYERS_MAX) {
+			if (time < layer_min[node])
+				layer_min[node] = time;
+			if (time > layer_max[node])
+				layer_max[node] = time;
+			layer_sum[node] += time;
+			layer_runs[node]++;
+		}
+	}
+}
+
+static void reset_stats(void)
+{
+	for (uint32_t i = 0; i < LAYERS_MAX; i++) {
+		layer_min[i] = UINT32_MAX;
+		layer_max[i] = 0;
+		layer_sum[i] = 0;
+		layer_runs[i] = 0;
+	}
+
+	run_min = UINT32_MAX;
+	run_max = 0;
+	run_sum = 0;
+	run_count = 0;
+	layers_num = 0;
+	layers_lost = 0;
+}
+
+static void save_input(uint32_t addr, const uint8_t *data, uint32_t len)
+{
+	if (input_copy_lost || input_copy_len + len > INPUT_COPY_SIZE) {
+		input_copy_lost = 1;
+		return;
+	}
+
+	// consecutive blocks of the same input are kept in the same segment
+	if (input_segs > 0 && input_seg_addr[input_segs - 1] + input_seg_len[input_segs - 1] == addr) {
+		input_seg_len[input_segs - 1] += len;
+	} else if (input_segs < INPUT_SEGS_MAX) {
+		input_seg_addr[input_segs] = addr;
+		input_seg_len[input_segs] = len;
+		input_segs++;
+	} else {
+		input_copy_lost = 1;
+		return;
+	}
+
+	memcpy(&input_copy[input_copy_len], data, len);
+	input_copy_len += len;
+}
+
+static void restore_inputs(void)
+{
+	uint32_t offset = 0;
+
+	for (uint32_t i = 0; i < input_segs; i++) {
+		write_ram(input_seg_addr[i], &input_copy[offset], input_seg_len[i]);
+		offset += input_seg_len[i];
+	}
+}
+
+static uint32_t get_clock(void)
+{
+	uint32_t freq = 5000000;
+
+	uint8_t ctrl10 = 0;
+	read(0x19, &ctrl10, 1);
+
+	if (ctrl10 & 0x4)
+		freq = 10000000;
+
+	return freq;
+}
+
 static void get_and_send_info()
 {
 	uint8_t saved_page = 0x00;
@@ -848,6 +1021,11 @@ void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
 		receiving_ucf = 1;
 		ucf_sunchon_page = 0;
 
+		// the inputs of the previous program are not restored
+		input_segs = 0;
+		input_copy_len = 0;
+		input_copy_lost = 0;
+
 		buf_i = 0;
 		buf_i_read = 0;
 		done = 0;
@@ -871,6 +1049,13 @@ void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
 
 		sscanf((char *)uart_buf, "in%lu%lu", &input_idx, &size);
 
+		// the first input starts a new set of inputs
+		if (input_idx == 0) {
+			input_segs = 0;
+			input_copy_len = 0;
+			input_copy_lost = 0;
+		}
+
 		block_size = size > BUF_SIZE ? BUF_SIZE : size;
 		HAL_UART_Receive_DMA(&huart2, buf[buf_i], block_size);
 
@@ -901,7 +1086,15 @@ void HAL_GPIO_EXTI_Callback(uint16_t GPIO_Pin)
 						__HAL_TIM_SET_COUNTER(&htim5, 0);
 						first_exec_int = 0;
 					} else {
-						layer_time[layer_next++] = __HAL_TIM_GET_COUNTER(&htim5) - layer_start;
+						uint16_t next = (layer_next + 1) % LAYERS_BUF_SIZE;
+						if (next == layer_curr) {
+							layers_lost++; // buffer full, not emptied by the main loop
+						} else {
+							layer_time[layer_next] = __HAL_TIM_GET_COUNTER(&htim5) - layer_start;
+							layer_node[layer_next] = layer_count;
+							layer_next = next;
+						}
+						layer_count++;
 					}
 					prev_int2_state = GPIO_PIN_RESET;
 				} else {
@@ -19,6 +19,12 @@
 
 #include "application.h"
 #include "ispu.h"
+#ifdef ISPU_IMAGE
+#include "ispu_image.h"
+#endif
+#ifdef ISPU_PATCH
+#include "ispu_patch.h"
+#endif
 
 #include "i2c.h"
 #include "spi.h"
@@ -28,6 +34,41 @@
 
 #define UART_BUF_SIZE 256
 
+// frames of the binary output: sync bytes, payload length, sequence number, timestamp [us], payload, CRC
+#define STREAM_BUF_SIZE 1024
+#define STREAM_SYNC_0 0xA5
+#define STREAM_SYNC_1 0x5A
+#define STREAM_HEADER_SIZE 10
+#define STREAM_CRC_SIZE 2
+
+// log-linear histogram of the execution times [us]: values below HIST_SUB have one bucket each, then each power of
+// two is split in HIST_SUB buckets (relative width at most 1 / HIST_SUB), up to 2^HIST_MAX_BITS us
+#define HIST_SUB_BITS 3
+#define HIST_SUB (1 << HIST_SUB_BITS)
+#define HIST_MAX_BITS 24
+#define HIST_BUCKETS (HIST_SUB * (HIST_MAX_BITS - HIST_SUB_BITS + 1))
+
+// records of the program image generated by ispu_pack.py (and of the patch generated by ispu_diff.py)
+#define IMAGE_VERSION 1
+#define IMAGE_MAX_BURST 4096
+#define IMAGE_OP_END 0x00
+#define IMAGE_OP_WRITE 0x01
+#define IMAGE_OP_DELAY 0x02
+#define IMAGE_OP_POLL_SET 0x03
+#define IMAGE_OP_POLL_RESET 0x04
+#define IMAGE_OP_READ 0x05
+#define IMAGE_OP_BURST 0x06
+#define IMAGE_OP_BURST_LZ 0x07
+#define IMAGE_OP_RAM 0x08
+#define IMAGE_OP_RAM_LZ 0x09
+
+#if defined(ISPU_IMAGE) && ISPU_CONF_IMAGE_MAX_BURST > IMAGE_MAX_BURST
+#error "The bursts of the ISPU program image are longer than IMAGE_MAX_BURST."
+#endif
+#if defined(ISPU_PATCH) && ISPU_PATCH_IMAGE_MAX_BURST > IMAGE_MAX_BURST
+#error "The RAM ranges of the ISPU patch are longer than IMAGE_MAX_BURST."
+#endif
+
 struct device {
 	char name[100];
 	uint8_t n_dev_names;
@@ -36,9 +77,17 @@ struct device {
 	uint8_t i2c_addr[2];
 	uint8_t spi;
 	uint8_t who_am_i;
+	uint8_t ram_access;
+	uint8_t ram_access_delay;
+	uint8_t ram_addr;
 	uint8_t ram_data;
 };
 
+union mem {
+	uint8_t bytes[4];
+	uint32_t value;
+};
+
 static struct device *get_device(char *name);
 static void set_comm_mode(uint8_t mode);
 static void set_i2c_addr(uint8_t addr);
@@ -46,6 +95,18 @@ static void read(uint8_t reg, uint8_t *val, uint32_t len);
 static void write(uint8_t reg, uint8_t val);
 static void write_mul(uint8_t reg, uint8_t *val, uint32_t len);
 uint8_t get_type_size(uint8_t type);
+static void stream_outputs(const int8_t *sensors);
+static void stream_flush(void);
+static uint16_t crc16(const uint8_t *data, uint32_t len);
+static uint32_t get_ispu_period(void);
+static uint16_t hist_bucket(uint32_t value);
+static uint32_t hist_lower(uint16_t bucket);
+static void hist_report(void);
+#if defined(ISPU_IMAGE) || defined(ISPU_PATCH)
+static void write_ram(uint32_t addr, uint8_t *buf, uint32_t len);
+static int8_t load_image(const uint8_t *image, uint32_t len);
+static uint32_t expand(const uint8_t *src, uint32_t src_len, uint8_t *dst, uint32_t dst_len);
+#endif
 
 static void interrupt_callback(uint16_t GPIO_Pin, uint8_t rising);
 
@@ -58,6 +119,9 @@ struct device devices[] = {
 		.i2c_addr = { 0xD4, 0xD6 },
 		.spi = 1,
 		.who_am_i = 0x22,
+		.ram_access = 0x80,
+		.ram_access_delay = 0,
+		.ram_addr = 0x08,
 		.ram_data = 0x0B
 	}
 };
@@ -82,13 +146,27 @@ static volatile uint32_t exec_time, max_exec_time, min_exec_time;
 static volatile uint64_t num_exec_time;
 static volatile float avg_exec_time;
 
+static volatile uint32_t hist[HIST_BUCKETS];
+static volatile uint32_t hist_overruns;
+static volatile uint32_t odr_period;
+
 static uint16_t print_results;
 static uint16_t print_time;
 
+static uint16_t stream_output;
+static uint16_t stream_size;
+static uint16_t stream_seq;
+static uint8_t stream_buf[2][STREAM_BUF_SIZE];
+static uint8_t stream_buf_i;
+static uint16_t stream_len;
+static volatile uint8_t uart_tx_busy;
+
 void application(void)
 {
 	HAL_Delay(1000);
 
+	HAL_TIM_Base_Start(&htim2); // timestamps of the binary output
+
 	int8_t sensors[ISPU_CONF_SENSORS_NUM];
 
 	for (uint32_t i = 0; i < ISPU_CONF_SENSORS_NUM; i++) {
@@ -171,6 +249,14 @@ void application(void)
 
 	for (uint32_t i = 0; i < ISPU_CONF_SENSORS_NUM; i++) {
 		// load configuration
+#ifdef ISPU_IMAGE
+		if (load_image(ispu_conf_images[i].data, ispu_conf_images[i].len) != 0) {
+			while (1) {
+				printf("Error: invalid ISPU program image\n");
+				HAL_Delay(1000);
+			}
+		}
+#else
 		uint32_t conf_len = ispu_conf_confs[i].len;
 		const struct mems_conf_op *conf = ispu_conf_confs[i].list;
 
@@ -211,12 +297,15 @@ void application(void)
 					HAL_Delay(conf[j].data);
 			}
 		}
+#endif
 
 		// print header for output data
 		uint32_t output_list_len = ispu_conf_output_lists[i].len;
 		const struct mems_conf_output *output_list = ispu_conf_output_lists[i].list;
 
 		for (uint32_t j = 0; j < output_list_len; j++) {
+			stream_size += output_list[j].len * get_type_size(output_list[j].type);
+
 			if (outputs)
 				printf("\t");
 
@@ -238,6 +327,8 @@ void application(void)
 	if (outputs)
 		printf("\n");
 
+	odr_period = get_ispu_period();
+
 	HAL_UART_Receive_IT(&huart1, (uint8_t *)&uart_char, 1);
 	enable_int = 1;
 	print_results = 1;
@@ -252,6 +343,15 @@ void application(void)
 					printf("Disabled results print.\n");
 			}
 
+			if (sscanf((char *)uart_buf, "bin%hu", &stream_output) > 0) {
+				if (stream_output) {
+					printf("Enabled binary output.\n");
+					stream_seq = 0;
+				} else {
+					printf("Disabled binary output.\n");
+				}
+			}
+
 			if (sscanf((char *)uart_buf, "time%hu", &print_time) > 0) {
 				if (print_time)
 					printf("Enabled execution time print.\n");
@@ -259,6 +359,24 @@ void application(void)
 					printf("Disabled execution time print.\n");
 			}
 
+			if (strcmp((char *)uart_buf, "hist") == 0)
+				hist_report();
+
+			if (strcmp((char *)uart_buf, "hist_reset") == 0) {
+				__disable_irq();
+				memset((void *)hist, 0, sizeof(hist));
+				hist_overruns = 0;
+				__enable_irq();
+				printf("Reset execution time histogram.\n");
+			}
+
+			uint32_t period;
+
+			if (sscanf((char *)uart_buf, "period%lu", &period) > 0) {
+				odr_period = period;
+				printf("Set sample period to %lu us.\n", period);
+			}
+
 			uint8_t reg, val;
 
 			if (sscanf((char *)uart_buf, "write%02hhX%02hhX", &reg, &val) == 2) {
@@ -285,6 +403,22 @@ void application(void)
 				printf("read 0x%02hhX = 0x%02hhX\n", reg, val);
 			}
 
+#ifdef ISPU_PATCH
+			if (strcmp((char *)uart_buf, "patch") == 0) {
+				// update the program while it is running, without resetting the ISPU
+				uint32_t start = HAL_GetTick();
+				int8_t ret = 0;
+
+				for (uint32_t i = 0; i < ISPU_PATCH_IMAGES_NUM && ret == 0; i++)
+					ret = load_image(ispu_patch_images[i].data, ispu_patch_images[i].len);
+
+				if (ret == 0)
+					printf("Applied patch in %lu ms.\n", HAL_GetTick() - start);
+				else
+					printf("Error: invalid ISPU patch\n");
+			}
+#endif
+
 			uart_size = 0;
 			uart_received = 0;
 		}
@@ -296,7 +430,11 @@ void application(void)
 			uint8_t ispu_int_status[4];
 			read(0x1A, ispu_int_status, 4);
 
-			if (print_results) {
+			if (stream_output) {
+				write(0x01, 0x80);
+				stream_outputs(sensors);
+				write(0x01, 0x00);
+			} else if (print_results) {
 				write(0x01, 0x80);
 
 				outputs = 0;
@@ -394,15 +532,94 @@ void application(void)
 			}
 		}
 
+		if (stream_output)
+			stream_flush();
+
 		if (sleep_int) {
 			sleep_int = 0;
 
-			if (print_time)
+			if (print_time && !stream_output)
 				printf("%lu\t%lu\t%lu\t%f\n", exec_time, min_exec_time, max_exec_time, avg_exec_time);
 		}
 	}
 }
 
+// The outputs are appended as a frame to the block being filled, which is sent as soon as the UART is free, while
+// the next frames are collected in the other block. If both blocks are busy, the frame is dropped, which the host
+// detects from the sequence number.
+static void stream_outputs(const int8_t *sensors)
+{
+	uint32_t frame_size = STREAM_HEADER_SIZE + stream_size + STREAM_CRC_SIZE;
+	uint32_t timestamp = __HAL_TIM_GET_COUNTER(&htim2);
+	uint16_t seq = stream_seq++;
+
+	if (stream_len + frame_size > STREAM_BUF_SIZE)
+		return;
+
+	uint8_t *frame = &stream_buf[stream_buf_i][stream_len];
+
+	frame[0] = STREAM_SYNC_0;
+	frame[1] = STREAM_SYNC_1;
+	frame[2] = stream_size & 0xFF;
+	frame[3] = stream_size >> 8;
+	frame[4] = seq & 0xFF;
+	frame[5] = seq >> 8;
+	memcpy(&frame[6], &timestamp, 4);
+
+	uint8_t *payload = &frame[STREAM_HEADER_SIZE];
+
+	for (uint32_t i = 0; i < ISPU_CONF_SENSORS_NUM; i++) {
+		if (sensors[i] == -1)
+			continue;
+
+		uint32_t output_list_len = ispu_conf_output_lists[i].len;
+		const struct mems_conf_output *output_list = ispu_conf_output_lists[i].list;
+
+		// the raw bytes of the output registers, as they are laid out by the ISPU
+		for (uint32_t j = 0; j < output_list_len; j++) {
+			uint32_t size = output_list[j].len * get_type_size(output_list[j].type);
+
+			read(output_list[j].reg_addr, payload, size);
+			payload += size;
+		}
+	}
+
+	uint16_t crc = crc16(&frame[2], STREAM_HEADER_SIZE - 2 + stream_size);
+	payload[0] = crc & 0xFF;
+	payload[1] = crc >> 8;
+
+	stream_len += frame_size;
+}
+
+static void stream_flush(void)
+{
+	if (uart_tx_busy || stream_len == 0)
+		return;
+
+	uart_tx_busy = 1;
+	if (HAL_UART_Transmit_IT(&huart1, stream_buf[stream_buf_i], stream_len) != HAL_OK) {
+		uart_tx_busy = 0;
+		return;
+	}
+
+	stream_buf_i ^= 1;
+	stream_len = 0;
+}
+
+// CRC-16/CCITT-FALSE (polynomial 0x1021, initial value 0xFFFF)
+static uint16_t crc16(const uint8_t *data, uint32_t len)
+{
+	uint16_t crc = 0xFFFF;
+
+	for (uint32_t i = 0; i < len; i++) {
+		crc ^= (uint16_t)data[i] << 8;
+		for (uint8_t k = 0; k < 8; k++)
+			crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+	}
+
+	return crc;
+}
+
 static struct device *get_device(char *name)
 {
 	struct device *dev = NULL;
@@ -512,6 +729,161 @@ static void write_mul(uint8_t reg, uint8_t *val, uint32_t len)
 	}
 }
 
+#if defined(ISPU_IMAGE) || defined(ISPU_PATCH)
+static int8_t load_image(const uint8_t *image, uint32_t len)
+{
+	static uint8_t burst_buf[IMAGE_MAX_BURST];
+
+	if (len < 5 || memcmp(image, "ISPU", 4) != 0 || image[4] != IMAGE_VERSION)
+		return -1;
+
+	uint32_t i = 5;
+
+	while (i < len) {
+		uint8_t op = image[i++];
+		uint8_t val;
+		uint32_t n, packed_n, addr;
+
+		// all records except the end one have at least one parameter
+		if (op != IMAGE_OP_END && i >= len)
+			return -1;
+
+		switch (op) {
+		case IMAGE_OP_END:
+			return 0;
+		case IMAGE_OP_WRITE:
+			if (i + 2 > len)
+				return -1;
+			write(image[i], image[i + 1]);
+			i += 2;
+			break;
+		case IMAGE_OP_DELAY:
+			HAL_Delay(image[i]);
+			i += 1;
+			break;
+		case IMAGE_OP_POLL_SET:
+		case IMAGE_OP_POLL_RESET:
+			if (i + 2 > len)
+				return -1;
+			do {
+				read(image[i], &val, 1);
+				val &= image[i + 1];
+			} while (op == IMAGE_OP_POLL_SET ? val != image[i + 1] : val != 0);
+			i += 2;
+			break;
+		case IMAGE_OP_READ:
+			read(image[i], &val, 1);
+			i += 1;
+			break;
+		case IMAGE_OP_BURST: // the payload is written directly from flash
+			if (i + 3 > len)
+				return -1;
+			n = image[i + 1] | (image[i + 2] << 8);
+			if (i + 3 + n > len)
+				return -1;
+			write_mul(image[i], (uint8_t *)&image[i + 3], n);
+			i += 3 + n;
+			break;
+		case IMAGE_OP_BURST_LZ:
+			if (i + 5 > len)
+				return -1;
+			n = image[i + 1] | (image[i + 2] << 8);
+			packed_n = image[i + 3] | (image[i + 4] << 8);
+			if (i + 5 + packed_n > len || n > sizeof(burst_buf))
+				return -1;
+			if (expand(&image[i + 5], packed_n, burst_buf, n) != n)
+				return -1;
+			write_mul(image[i], burst_buf, n);
+			i += 5 + packed_n;
+			break;
+		case IMAGE_OP_RAM:
+			if (i + 5 > len)
+				return -1;
+			addr = image[i] | (image[i + 1] << 8) | (image[i + 2] << 16);
+			n = image[i + 3] | (image[i + 4] << 8);
+			if (i + 5 + n > len)
+				return -1;
+			write_ram(addr, (uint8_t *)&image[i + 5], n);
+			i += 5 + n;
+			break;
+		case IMAGE_OP_RAM_LZ:
+			if (i + 7 > len)
+				return -1;
+			addr = image[i] | (image[i + 1] << 8) | (image[i + 2] << 16);
+			n = image[i + 3] | (image[i + 4] << 8);
+			packed_n = image[i + 5] | (image[i + 6] << 8);
+			if (i + 7 + packed_n > len || n > sizeof(burst_buf))
+				return -1;
+			if (expand(&image[i + 7], packed_n, burst_buf, n) != n)
+				return -1;
+			write_ram(addr, burst_buf, n);
+			i += 7 + packed_n;
+			break;
+		default:
+			return -1;
+		}
+	}
+
+	return -1; // end record missing
+}
+
+static uint32_t expand(const uint8_t *src, uint32_t src_len, uint8_t *dst, uint32_t dst_len)
+{
+	uint32_t i = 0;
+	uint32_t o = 0;
+
+	while (i < src_len) {
+		uint8_t token = src[i++];
+
+		if (token < 0x80) { // literal bytes
+			uint32_t n = token + 1u;
+			if (i + n > src_len || o + n > dst_len)
+				return 0;
+			memcpy(&dst[o], &src[i], n);
+			i += n;
+			o += n;
+		} else { // copy of previous bytes, possibly overlapping the ones being written
+			if (i + 2 > src_len)
+				return 0;
+			uint32_t dist = src[i] | (src[i + 1] << 8);
+			uint32_t n = (token & 0x7Fu) + 3u;
+			i += 2;
+			if (dist == 0 || dist > o || o + n > dst_len)
+				return 0;
+			for (uint32_t k = 0; k < n; k++, o++)
+				dst[o] = dst[o - dist];
+		}
+	}
+
+	return o;
+}
+
+static void write_ram(uint32_t addr, uint8_t *buf, uint32_t len)
+{
+	uint8_t saved_page = 0x00, saved_clock = 0x01;
+
+	read(0x01, &saved_page, 1);
+	write(0x01, dev->ram_access);
+
+	HAL_Delay(dev->ram_access_delay);
+
+	read(0x02, &saved_clock, 1);
+	write(0x02, 0x03); // disable the clock
+
+	union mem address;
+	address.value = addr;
+
+	write(dev->ram_addr, address.bytes[2]); // set write mode and ram address
+	write(dev->ram_addr + 1, address.bytes[1]); // set ram address
+	write(dev->ram_addr + 2, address.bytes[0]); // set ram address
+
+	write_mul(dev->ram_data, buf, len);
+
+	write(0x02, saved_clock);
+	write(0x01, saved_page);
+}
+#endif
+
 void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
 {
 	if (uart_char == '\n') {
@@ -528,8 +900,16 @@ void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
 	HAL_UART_Receive_IT(&huart1, (uint8_t *)&uart_char, 1);
 }
 
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
+{
+	uart_tx_busy = 0;
+}
+
 int _write(int fd, const void *buf, size_t count)
 {
+	while (uart_tx_busy) // binary output block being sent
+		;
+
 	uint8_t status = HAL_UART_Transmit(&huart1, (uint8_t *)buf, count, HAL_MAX_DELAY);
 
 	return (status == HAL_OK ? count : 0);
@@ -567,8 +947,14 @@ static void interrupt_callback(uint16_t GPIO_Pin, uint8_t rising)
 					avg_exec_time = exec_time;
 					min_exec_time = UINT32_MAX;
 					max_exec_time = 0;
+					memset((void *)hist, 0, sizeof(hist));
+					hist_overruns = 0;
 				}
 
+				hist[hist_bucket(exec_time)]++;
+				if (odr_period > 0 && exec_time > odr_period)
+					hist_overruns++;
+
 				avg_exec_time += (float)(exec_time - avg_exec_time) / (float)num_exec_time;
 				if (exec_time < min_exec_time)
 					min_exec_time = exec_time;
@@ -581,6 +967,93 @@ static void interrupt_callback(uint16_t GPIO_Pin, uint8_t rising)
 	}
 }
 
+// Period of the samples processed by the ISPU [us]: the ISPU is triggered at ISPU_RATE (bits [7:4] of register 18h),
+// written by the configuration independently of the output data rates of the sensors, 0 if the ISPU is not triggered
+// periodically
+static uint32_t get_ispu_period(void)
+{
+	static const uint32_t periods[] = { 0, 80000, 38462, 19231, 9615, 4808, 2404, 1200, 600, 300, 150 }; // [us]
+
+	uint8_t ctrl;
+	read(0x18, &ctrl, 1);
+
+	uint8_t rate = ctrl >> 4;
+
+	return rate < sizeof(periods) / sizeof(periods[0]) ? periods[rate] : 0;
+}
+
+static uint16_t hist_bucket(uint32_t value)
+{
+	if (value < HIST_SUB)
+		return value;
+
+	uint32_t msb = 31 - __builtin_clz(value);
+	if (msb >= HIST_MAX_BITS)
+		return HIST_BUCKETS - 1;
+
+	uint32_t sub = (value >> (msb - HIST_SUB_BITS)) & (HIST_SUB - 1);
+
+	return (msb - HIST_SUB_BITS + 1) * HIST_SUB + sub;
+}
+
+static uint32_t hist_lower(uint16_t bucket)
+{
+	if (bucket < HIST_SUB)
+		return bucket;
+
+	uint32_t shift = bucket / HIST_SUB - 1;
+
+	return (HIST_SUB + bucket % HIST_SUB) << shift;
+}
+
+// The percentiles are the upper bounds of the buckets containing them (limited to the maximum), so they overestimate
+// the actual values by less than 1 / HIST_SUB.
+static void hist_report(void)
+{
+	static const uint16_t permille[] = { 500, 900, 990, 999 };
+	static const char *const names[] = { "P50", "P90", "P99", "P99.9" };
+	static uint32_t counts[HIST_BUCKETS];
+
+	__disable_irq();
+	memcpy(counts, (const void *)hist, sizeof(counts));
+	uint32_t overruns = hist_overruns;
+	uint32_t max = max_exec_time;
+	__enable_irq();
+
+	uint32_t total = 0;
+	for (uint16_t i = 0; i < HIST_BUCKETS; i++)
+		total += counts[i];
+
+	printf("Executions: %lu\n", total);
+	printf("Overruns: %lu (sample period %lu us)\n", overruns, odr_period);
+
+	if (total == 0)
+		return;
+
+	for (uint8_t p = 0; p < sizeof(permille) / sizeof(permille[0]); p++) {
+		uint32_t rank = ((uint64_t)total * permille[p] + 999) / 1000;
+		uint32_t cumulative = 0;
+		uint16_t i = 0;
+
+		while (cumulative + counts[i] < rank)
+			cumulative += counts[i++];
+
+		uint32_t upper = i < HIST_BUCKETS - 1 ? hist_lower(i + 1) - 1 : UINT32_MAX;
+		printf("%s: %lu us\n", names[p], upper < max ? upper : max);
+	}
+
+	// non-empty buckets: lower bound, upper bound, count
+	for (uint16_t i = 0; i < HIST_BUCKETS; i++) {
+		if (counts[i] == 0)
+			continue;
+
+		if (i < HIST_BUCKETS - 1)
+			printf("%lu\t%lu\t%lu\n", hist_lower(i), hist_lower(i + 1) - 1, counts[i]);
+		else
+			printf("%lu\t-\t%lu\n", hist_lower(i), counts[i]);
+	}
+}
+
 uint8_t get_type_size(uint8_t type)
 {
 	const struct {
@@ -24,6 +24,14 @@
 #include "iir2.h"
 #include "ispu_wand_params.h"
 
+// maximum number of network nodes run at each sample (the inference is spread over several samples)
+#define NODES_PER_SAMPLE 1u
+
+// the inference must be complete before the next window can start
+#if ((STAI_NETWORK_NODES_NUM + NODES_PER_SAMPLE - 1u) / NODES_PER_SAMPLE) > (RESET_LEN_SAMPLES + TRIG_LEN_SAMPLES)
+#error "NODES_PER_SAMPLE too low for the reset and trigger lengths"
+#endif
+
 enum {
 	STATE_READY,
 	STATE_UPDATE,
@@ -37,6 +45,12 @@ static uint16_t win_cnt;
 static uint16_t reset_cnt;
 static uint8_t prediction;
 
+// class probabilities of the last inference, since the output buffer is overwritten by the nodes of the next one
+static float probs[NUM_LABELS];
+
+// next node to run, STAI_NETWORK_NODES_NUM when no inference is running
+static stai_size infer_node;
+
 void __attribute__ ((signal)) algo_00_init(void);
 void __attribute__ ((signal)) algo_00(void);
 
@@ -47,20 +61,24 @@ static stai_ptr output_buffers[STAI_NETWORK_OUT_NUM];
 
 static volatile uint32_t int_status;
 
-uint8_t run_inference(float *output)
+uint8_t run_inference_step(float *output)
 {
-	uint8_t pred = LABEL_NULL;
-	stai_return_code res = stai_network_run(net, STAI_MODE_SYNC);
-	if (res == STAI_SUCCESS) {
-		float max_prob = -1.0f;
-		for (uint8_t i = 0; i < NUM_LABELS; i++) {
-			if (output[i] > max_prob) {
-				max_prob = output[i];
-				pred = i;
+	uint8_t pred = prediction;
+	stai_return_code res = run_network_step(net, &infer_node, NODES_PER_SAMPLE);
+	if (infer_node == STAI_NETWORK_NODES_NUM) {
+		pred = LABEL_NULL;
+		if (res == STAI_SUCCESS) {
+			float max_prob = -1.0f;
+			for (uint8_t i = 0; i < NUM_LABELS; i++) {
+				probs[i] = output[i];
+				if (output[i] > max_prob) {
+					max_prob = output[i];
+					pred = i;
+				}
+			}
+			if (max_prob < PRED_THS) {
+				pred = LABEL_NULL;
 			}
-		}
-		if (max_prob < PRED_THS) {
-			pred = LABEL_NULL;
 		}
 	}
 
@@ -86,10 +104,14 @@ void __attribute__ ((signal)) algo_00_init(void)
 
 	// initialize state logic variables
 	prediction = LABEL_NULL;
+	for (uint8_t i = 0; i < NUM_LABELS; i++) {
+		probs[i] = 0.0f;
+	}
 	algo_state = STATE_RESET;
 	trig_cnt = 0;
 	win_cnt = 0;
 	reset_cnt = 0;
+	infer_node = STAI_NETWORK_NODES_NUM;
 }
 
 void __attribute__ ((signal)) algo_00(void)
@@ -125,7 +147,7 @@ void __attribute__ ((signal)) algo_00(void)
 		}
 		break;
 
-	// update input buffer
+	// update acquisition window, directly in the input buffer since the inference of the previous window is complete
 	case STATE_UPDATE:
 		for (uint8_t ch = 0; ch < NUM_AXES; ch++) {
 			input[0][win_cnt][ch] = filt_data[ch];
@@ -133,7 +155,7 @@ void __attribute__ ((signal)) algo_00(void)
 		win_cnt++;
 		if (win_cnt == WIN_LEN_SAMPLES) {
 			win_cnt = 0;
-			prediction = run_inference(output[0]);
+			infer_node = 0;
 			algo_state = STATE_RESET;
 		}
 		break;
@@ -148,6 +170,11 @@ void __attribute__ ((signal)) algo_00(void)
 		break;
 	}
 
+	// run the next nodes of the inference, if running
+	if (infer_node < STAI_NETWORK_NODES_NUM) {
+		prediction = run_inference_step(output[0]);
+	}
+
 	// write results to output registers
 	uint32_t addr = ISPU_DOUT_00;
 	for (uint8_t i = 0; i < NUM_AXES; i++) {
@@ -155,10 +182,10 @@ void __attribute__ ((signal)) algo_00(void)
 		addr += sizeof(float);
 	}
 
-	cast_uint8_t(addr) = algo_state == STATE_UPDATE ? (uint8_t)1 : (uint8_t)0;
+	cast_uint8_t(addr) = (algo_state == STATE_UPDATE || infer_node < STAI_NETWORK_NODES_NUM) ? (uint8_t)1 : (uint8_t)0;
 	addr += sizeof(uint8_t);
 	for (uint8_t i = 0; i < NUM_LABELS; i++) {
-		cast_float(addr) = output[0][i];
+		cast_float(addr) = probs[i];
 		addr += sizeof(float);
 	}
 	cast_char(addr) = LABELS[prediction];
@@ -446,6 +446,53 @@ stai_return_code stai_network_set_callback(
 
 
 
+/* STAI_STEP BEGIN (added by stai_step.py, do not edit) */
+/**
+ * @brief Run a range of nodes of the network.
+ * @details the nodes are executed in the same order as @ref stai_network_run(), so that calling this API for
+ *          consecutive ranges covering all the nodes (STAI_NETWORK_NODES_NUM) gives the same result.
+ * @param[in] network network context opaque pointer
+ * @param[in] first index of the first node to run
+ * @param[in] n_nodes number of nodes to run
+ * @return STAI_SUCCESS on correct run, else error 1st return code from @ref stai_return_code enums.
+ */
+#define STAI_NETWORK_RUN_NODES
+
+STAI_API_ENTRY
+stai_return_code stai_network_run_nodes(
+  stai_network* network,
+  const stai_size first,
+  const stai_size n_nodes);
+/* STAI_STEP END */
+
+/* STAI_PLAN BEGIN (added by stai_plan.py, do not edit) */
+/*
+ * tensor                              bytes  location                 lifetime (nodes)
+ * input_output                         1248  activations[0] 2196-3443 before-0
+ * conv_hidden_0_conv2d_output          3328  activations[0] 0-3327    0-1
+ * conv_hidden_0_output                 3328  activations[0] 0-3327    1-2
+ * batch_normalization_output           3328  activations[0] 0-3327    2-3
+ * max_pooling1d_output                 1664  activations[0] 0-1663    3-4
+ * conv_hidden_1_conv2d_output          1664  activations[0] 1664-3327 4-5
+ * conv_hidden_1_output                 1664  activations[0] 0-1663    5-6
+ * batch_normalization_1_output         1664  activations[0] 1664-3327 6-7
+ * max_pooling1d_1_output                832  activations[0] 0-831     7-8
+ * conv_hidden_2_conv2d_output           832  activations[0] 832-1663  8-9
+ * conv_hidden_2_output                  832  activations[0] 0-831     9-10
+ * batch_normalization_2_output          832  activations[0] 832-1663  10-11
+ * max_pooling1d_2_output                416  activations[0] 0-415     11-12
+ * dense_out_output                       16  activations[0] 416-431   12-13
+ * output_output                          16  activations[0] 0-15      13-after
+ *
+ * activations in use (peak): 3444 bytes at node 0
+ * activations buffer: 3444 bytes
+ * inputs: in activations (ST Edge AI Core)
+ * outputs: in activations (ST Edge AI Core)
+ * states: 0 bytes
+ * RAM allocated by init_network_buffers: 3444 bytes (3444 bytes without planning)
+ */
+/* STAI_PLAN END */
+
 STAI_API_DECLARE_END
 
 #endif    /* STAI_NETWORK_H */
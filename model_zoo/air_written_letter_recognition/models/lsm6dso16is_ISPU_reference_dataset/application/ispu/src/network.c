@@ -991,6 +991,255 @@ stai_return_code stai_network_set_callback(
   return net_ctx->_return_code;
 }
 
+/* STAI_STEP BEGIN (added by stai_step.py, do not edit) */
+STAI_API_ENTRY
+stai_return_code stai_network_run_nodes(
+  stai_network* network,
+  const stai_size first,
+  const stai_size n_nodes)
+{
+  _STAI_CONTEXT_ACQUIRE(net_ctx, network)
+
+  _STAI_SET_ERROR(net_ctx, (net_ctx->_flags & STAI_FLAG_ACTIVATIONS) != STAI_FLAG_ACTIVATIONS,
+        STAI_ERROR_NETWORK_INVALID_ACTIVATIONS_PTR, net_ctx->_return_code)
+
+  _STAI_SET_ERROR(net_ctx, (net_ctx->_flags & STAI_FLAG_INPUTS) != STAI_FLAG_INPUTS,
+                  STAI_ERROR_NETWORK_INVALID_IN_PTR, net_ctx->_return_code)
+  _STAI_SET_ERROR(net_ctx, (net_ctx->_flags & STAI_FLAG_OUTPUTS) != STAI_FLAG_OUTPUTS,
+                  STAI_ERROR_NETWORK_INVALID_OUT_PTR, net_ctx->_return_code)
+
+  _STAI_SET_ERROR(net_ctx, (net_ctx->_flags & STAI_FLAG_WEIGHTS) != STAI_FLAG_WEIGHTS,
+                  STAI_ERROR_NETWORK_INVALID_WEIGHTS_PTR, net_ctx->_return_code)
+
+  for (stai_size node = first; (node < (first + n_nodes)) && (node < 14); node++) {
+    switch (node) {
+    case 0: /* conv_hidden_0_conv2d */
+  {
+      const ai_float* conv_hidden_0_conv2d_t_in_0_ptr_const_f32 = (ai_float*)(net_ctx->_inputs[0] + 0);
+    ai_float* conv_hidden_0_conv2d_t_out_0_ptr_f32 = (ai_float*)(net_ctx->_activations[0] + 0);
+    const ai_u8* conv_hidden_0_conv2d_t_weight_0_ptr_const_u8 = (ai_u8*)(net_ctx->_weights[0] + 0);
+    const ai_u8* conv_hidden_0_conv2d_t_weight_1_ptr_const_u8 = (ai_u8*)(net_ctx->_weights[0] + 288);
+    ai_float* conv_hidden_0_conv2d_t_scratch_0_ptr_f32 = (ai_float*)(NULL);
+    const ai_u32 conv_hidden_0_conv2d_t_in_0_shape_ch_const_u32 = 3;
+    const ai_u32 conv_hidden_0_conv2d_t_out_0_shape_ch_const_u32 = 8;
+    const ai_u32 conv_hidden_0_conv2d_t_in_0_shape_w_const_u32 = 1;
+    const ai_u32 conv_hidden_0_conv2d_t_in_0_shape_h_const_u32 = 104;
+    const ai_u32 conv_hidden_0_conv2d_t_out_0_shape_w_const_u32 = 1;
+    const ai_u32 conv_hidden_0_conv2d_t_out_0_shape_h_const_u32 = 104;
+    const ai_u32 conv_hidden_0_conv2d_t_weight_0_shape_w_const_u32 = 1;
+    const ai_u32 conv_hidden_0_conv2d_t_weight_0_shape_h_const_u32 = 3;
+    const ai_i32 conv_hidden_0_conv2d_l_pad_W_0_const_s32 = 0;
+    const ai_i32 conv_hidden_0_conv2d_l_pad_H_0_const_s32 = 1;
+    const ai_u16 conv_hidden_0_conv2d_l_stride_1_const_u16 = 1;
+    const ai_u16 conv_hidden_0_conv2d_l_stride_0_const_u16 = 1;
+    const ai_u16 conv_hidden_0_conv2d_l_dilation_H_const_u16 = 1;
+    const ai_u16 conv_hidden_0_conv2d_l_dilation_W_const_u16 = 1;
+  
+  _STAI_NETWORK_EVENT_NODE_START_CB(1, 1, {(stai_ptr) conv_hidden_0_conv2d_t_in_0_ptr_const_f32});
+    
+  forward_lite_conv2d_if32of32wf32(conv_hidden_0_conv2d_t_in_0_ptr_const_f32, conv_hidden_0_conv2d_t_out_0_ptr_f32, conv_hidden_0_conv2d_t_weight_0_ptr_const_u8, conv_hidden_0_conv2d_t_weight_1_ptr_const_u8, conv_hidden_0_conv2d_t_scratch_0_ptr_f32, conv_hidden_0_conv2d_t_in_0_shape_ch_const_u32, conv_hidden_0_conv2d_t_out_0_shape_ch_const_u32, conv_hidden_0_conv2d_t_in_0_shape_w_const_u32, conv_hidden_0_conv2d_t_in_0_shape_h_const_u32, conv_hidden_0_conv2d_t_out_0_shape_w_const_u32, conv_hidden_0_conv2d_t_out_0_shape_h_const_u32, conv_hidden_0_conv2d_t_weight_0_shape_w_const_u32, conv_hidden_0_conv2d_t_weight_0_shape_h_const_u32, conv_hidden_0_conv2d_l_pad_W_0_const_s32, conv_hidden_0_conv2d_l_pad_H_0_const_s32, conv_hidden_0_conv2d_l_stride_1_const_u16, conv_hidden_0_conv2d_l_stride_0_const_u16, 3, 1, conv_hidden_0_conv2d_l_dilation_H_const_u16, conv_hidden_0_conv2d_l_dilation_W_const_u16, (ai_size)(1));
+    
+  _STAI_NETWORK_EVENT_NODE_STOP_CB(1, 1, {(stai_ptr) conv_hidden_0_conv2d_t_out_0_ptr_f32});
+  }
+    break;
+    case 1: /* conv_hidden_0 */
+  {
+      ai_handle conv_hidden_0_t_out_0_ptr_handle = (ai_handle)(net_ctx->_activations[0] + 0);
+    const ai_handle conv_hidden_0_t_in_0_ptr_const_handle = (ai_handle)(net_ctx->_activations[0] + 0);
+    const ai_i32 conv_hidden_0_t_in_0_shape_ch_h_prod_const_s32 = 832;
+  
+  _STAI_NETWORK_EVENT_NODE_START_CB(1, 1, {(stai_ptr) conv_hidden_0_t_in_0_ptr_const_handle});
+    
+  forward_lite_nl_relu_if32of32(conv_hidden_0_t_out_0_ptr_handle, conv_hidden_0_t_in_0_ptr_const_handle, conv_hidden_0_t_in_0_shape_ch_h_prod_const_s32, NULL);
+    
+  _STAI_NETWORK_EVENT_NODE_STOP_CB(1, 1, {(stai_ptr) conv_hidden_0_t_out_0_ptr_handle});
+  }
+    break;
+    case 2: /* batch_normalization */
+  {
+      ai_float* batch_normalization_t_out_0_ptr_f32 = (ai_float*)(net_ctx->_activations[0] + 0);
+    const ai_float* batch_normalization_t_in_0_ptr_const_f32 = (ai_float*)(net_ctx->_activations[0] + 0);
+    const ai_float* batch_normalization_t_weight_0_ptr_const_f32 = (ai_float*)(net_ctx->_weights[0] + 320);
+    const ai_float* batch_normalization_t_weight_1_ptr_const_f32 = (ai_float*)(net_ctx->_weights[0] + 352);
+  
+  _STAI_NETWORK_EVENT_NODE_START_CB(2, 1, {(stai_ptr) batch_normalization_t_in_0_ptr_const_f32});
+    
+  forward_lite_bn_if32of32wf32(batch_normalization_t_out_0_ptr_f32, batch_normalization_t_in_0_ptr_const_f32, batch_normalization_t_weight_0_ptr_const_f32, batch_normalization_t_weight_1_ptr_const_f32, (ai_u32)(832), (ai_size)(8));
+    
+  _STAI_NETWORK_EVENT_NODE_STOP_CB(2, 1, {(stai_ptr) batch_normalization_t_out_0_ptr_f32});
+  }
+    break;
+    case 3: /* max_pooling1d */
+  {
+    
+  forward_lite_mp_max_pooling1d(net_ctx);
+  }
+    break;
+    case 4: /* conv_hidden_1_conv2d */
+  {
+      const ai_float* conv_hidden_1_conv2d_t_in_0_ptr_const_f32 = (ai_float*)(net_ctx->_activations[0] + 0);
+    ai_float* conv_hidden_1_conv2d_t_out_0_ptr_f32 = (ai_float*)(net_ctx->_activations[0] + 1664);
+    const ai_u8* conv_hidden_1_conv2d_t_weight_0_ptr_const_u8 = (ai_u8*)(net_ctx->_weights[0] + 384);
+    const ai_u8* conv_hidden_1_conv2d_t_weight_1_ptr_const_u8 = (ai_u8*)(net_ctx->_weights[0] + 1152);
+    ai_float* conv_hidden_1_conv2d_t_scratch_0_ptr_f32 = (ai_float*)(NULL);
+    const ai_u32 conv_hidden_1_conv2d_t_in_0_shape_ch_const_u32 = 8;
+    const ai_u32 conv_hidden_1_conv2d_t_out_0_shape_ch_const_u32 = 8;
+    const ai_u32 conv_hidden_1_conv2d_t_in_0_shape_w_const_u32 = 1;
+    const ai_u32 conv_hidden_1_conv2d_t_in_0_shape_h_const_u32 = 52;
+    const ai_u32 conv_hidden_1_conv2d_t_out_0_shape_w_const_u32 = 1;
+    const ai_u32 conv_hidden_1_conv2d_t_out_0_shape_h_const_u32 = 52;
+    const ai_u32 conv_hidden_1_conv2d_t_weight_0_shape_w_const_u32 = 1;
+    const ai_u32 conv_hidden_1_conv2d_t_weight_0_shape_h_const_u32 = 3;
+    const ai_i32 conv_hidden_1_conv2d_l_pad_W_0_const_s32 = 0;
+    const ai_i32 conv_hidden_1_conv2d_l_pad_H_0_const_s32 = 1;
+    const ai_u16 conv_hidden_1_conv2d_l_stride_1_const_u16 = 1;
+    const ai_u16 conv_hidden_1_conv2d_l_stride_0_const_u16 = 1;
+    const ai_u16 conv_hidden_1_conv2d_l_dilation_H_const_u16 = 1;
+    const ai_u16 conv_hidden_1_conv2d_l_dilation_W_const_u16 = 1;
+  
+  _STAI_NETWORK_EVENT_NODE_START_CB(4, 1, {(stai_ptr) conv_hidden_1_conv2d_t_in_0_ptr_const_f32});
+    
+  forward_lite_conv2d_if32of32wf32(conv_hidden_1_conv2d_t_in_0_ptr_const_f32, conv_hidden_1_conv2d_t_out_0_ptr_f32, conv_hidden_1_conv2d_t_weight_0_ptr_const_u8, conv_hidden_1_conv2d_t_weight_1_ptr_const_u8, conv_hidden_1_conv2d_t_scratch_0_ptr_f32, conv_hidden_1_conv2d_t_in_0_shape_ch_const_u32, conv_hidden_1_conv2d_t_out_0_shape_ch_const_u32, conv_hidden_1_conv2d_t_in_0_shape_w_const_u32, conv_hidden_1_conv2d_t_in_0_shape_h_const_u32, conv_hidden_1_conv2d_t_out_0_shape_w_const_u32, conv_hidden_1_conv2d_t_out_0_shape_h_const_u32, conv_hidden_1_conv2d_t_weight_0_shape_w_const_u32, conv_hidden_1_conv2d_t_weight_0_shape_h_const_u32, conv_hidden_1_conv2d_l_pad_W_0_const_s32, conv_hidden_1_conv2d_l_pad_H_0_const_s32, conv_hidden_1_conv2d_l_stride_1_const_u16, conv_hidden_1_conv2d_l_stride_0_const_u16, 3, 1, conv_hidden_1_conv2d_l_dilation_H_const_u16, conv_hidden_1_conv2d_l_dilation_W_const_u16, (ai_size)(1));
+    
+  _STAI_NETWORK_EVENT_NODE_STOP_CB(4, 1, {(stai_ptr) conv_hidden_1_conv2d_t_out_0_ptr_f32});
+  }
+    break;
+    case 5: /* conv_hidden_1 */
+  {
+      ai_handle conv_hidden_1_t_out_0_ptr_handle = (ai_handle)(net_ctx->_activations[0] + 0);
+    const ai_handle conv_hidden_1_t_in_0_ptr_const_handle = (ai_handle)(net_ctx->_activations[0] + 1664);
+    const ai_i32 conv_hidden_1_t_in_0_shape_ch_h_prod_const_s32 = 416;
+  
+  _STAI_NETWORK_EVENT_NODE_START_CB(4, 1, {(stai_ptr) conv_hidden_1_t_in_0_ptr_const_handle});
+    
+  forward_lite_nl_relu_if32of32(conv_hidden_1_t_out_0_ptr_handle, conv_hidden_1_t_in_0_ptr_const_handle, conv_hidden_1_t_in_0_shape_ch_h_prod_const_s32, NULL);
+    
+  _STAI_NETWORK_EVENT_NODE_STOP_CB(4, 1, {(stai_ptr) conv_hidden_1_t_out_0_ptr_handle});
+  }
+    break;
+    case 6: /* batch_normalization_1 */
+  {
+      ai_float* batch_normalization_1_t_out_0_ptr_f32 = (ai_float*)(net_ctx->_activations[0] + 1664);
+    const ai_float* batch_normalization_1_t_in_0_ptr_const_f32 = (ai_float*)(net_ctx->_activations[0] + 0);
+    const ai_float* batch_normalization_1_t_weight_0_ptr_const_f32 = (ai_float*)(net_ctx->_weights[0] + 1184);
+    const ai_float* batch_normalization_1_t_weight_1_ptr_const_f32 = (ai_float*)(net_ctx->_weights[0] + 1216);
+  
+  _STAI_NETWORK_EVENT_NODE_START_CB(5, 1, {(stai_ptr) batch_normalization_1_t_in_0_ptr_const_f32});
+    
+  forward_lite_bn_if32of32wf32(batch_normalization_1_t_out_0_ptr_f32, batch_normalization_1_t_in_0_ptr_const_f32, batch_normalization_1_t_weight_0_ptr_const_f32, batch_normalization_1_t_weight_1_ptr_const_f32, (ai_u32)(416), (ai_size)(8));
+    
+  _STAI_NETWORK_EVENT_NODE_STOP_CB(5, 1, {(stai_ptr) batch_normalization_1_t_out_0_ptr_f32});
+  }
+    break;
+    case 7: /* max_pooling1d_1 */
+  {
+    
+  forward_lite_mp_max_pooling1d_1(net_ctx);
+  }
+    break;
+    case 8: /* conv_hidden_2_conv2d */
+  {
+      const ai_float* conv_hidden_2_conv2d_t_in_0_ptr_const_f32 = (ai_float*)(net_ctx->_activations[0] + 0);
+    ai_float* conv_hidden_2_conv2d_t_out_0_ptr_f32 = (ai_float*)(net_ctx->_activations[0] + 832);
+    const ai_u8* conv_hidden_2_conv2d_t_weight_0_ptr_const_u8 = (ai_u8*)(net_ctx->_weights[0] + 1248);
+    const ai_u8* conv_hidden_2_conv2d_t_weight_1_ptr_const_u8 = (ai_u8*)(net_ctx->_weights[0] + 2016);
+    ai_float* conv_hidden_2_conv2d_t_scratch_0_ptr_f32 = (ai_float*)(NULL);
+    const ai_u32 conv_hidden_2_conv2d_t_in_0_shape_ch_const_u32 = 8;
+    const ai_u32 conv_hidden_2_conv2d_t_out_0_shape_ch_const_u32 = 8;
+    const ai_u32 conv_hidden_2_conv2d_t_in_0_shape_w_const_u32 = 1;
+    const ai_u32 conv_hidden_2_conv2d_t_in_0_shape_h_const_u32 = 26;
+    const ai_u32 conv_hidden_2_conv2d_t_out_0_shape_w_const_u32 = 1;
+    const ai_u32 conv_hidden_2_conv2d_t_out_0_shape_h_const_u32 = 26;
+    const ai_u32 conv_hidden_2_conv2d_t_weight_0_shape_w_const_u32 = 1;
+    const ai_u32 conv_hidden_2_conv2d_t_weight_0_shape_h_const_u32 = 3;
+    const ai_i32 conv_hidden_2_conv2d_l_pad_W_0_const_s32 = 0;
+    const ai_i32 conv_hidden_2_conv2d_l_pad_H_0_const_s32 = 1;
+    const ai_u16 conv_hidden_2_conv2d_l_stride_1_const_u16 = 1;
+    const ai_u16 conv_hidden_2_conv2d_l_stride_0_const_u16 = 1;
+    const ai_u16 conv_hidden_2_conv2d_l_dilation_H_const_u16 = 1;
+    const ai_u16 conv_hidden_2_conv2d_l_dilation_W_const_u16 = 1;
+  
+  _STAI_NETWORK_EVENT_NODE_START_CB(7, 1, {(stai_ptr) conv_hidden_2_conv2d_t_in_0_ptr_const_f32});
+    
+  forward_lite_conv2d_if32of32wf32(conv_hidden_2_conv2d_t_in_0_ptr_const_f32, conv_hidden_2_conv2d_t_out_0_ptr_f32, conv_hidden_2_conv2d_t_weight_0_ptr_const_u8, conv_hidden_2_conv2d_t_weight_1_ptr_const_u8, conv_hidden_2_conv2d_t_scratch_0_ptr_f32, conv_hidden_2_conv2d_t_in_0_shape_ch_const_u32, conv_hidden_2_conv2d_t_out_0_shape_ch_const_u32, conv_hidden_2_conv2d_t_in_0_shape_w_const_u32, conv_hidden_2_conv2d_t_in_0_shape_h_const_u32, conv_hidden_2_conv2d_t_out_0_shape_w_const_u32, conv_hidden_2_conv2d_t_out_0_shape_h_const_u32, conv_hidden_2_conv2d_t_weight_0_shape_w_const_u32, conv_hidden_2_conv2d_t_weight_0_shape_h_const_u32, conv_hidden_2_conv2d_l_pad_W_0_const_s32, conv_hidden_2_conv2d_l_pad_H_0_const_s32, conv_hidden_2_conv2d_l_stride_1_const_u16, conv_hidden_2_conv2d_l_stride_0_const_u16, 3, 1, conv_hidden_2_conv2d_l_dilation_H_const_u16, conv_hidden_2_conv2d_l_dilation_W_const_u16, (ai_size)(1));
+    
+  _STAI_NETWORK_EVENT_NODE_STOP_CB(7, 1, {(stai_ptr) conv_hidden_2_conv2d_t_out_0_ptr_f32});
+  }
+    break;
+    case 9: /* conv_hidden_2 */
+  {
+      ai_handle conv_hidden_2_t_out_0_ptr_handle = (ai_handle)(net_ctx->_activations[0] + 0);
+    const ai_handle conv_hidden_2_t_in_0_ptr_const_handle = (ai_handle)(net_ctx->_activations[0] + 832);
+    const ai_i32 conv_hidden_2_t_in_0_shape_ch_h_prod_const_s32 = 208;
+  
+  _STAI_NETWORK_EVENT_NODE_START_CB(7, 1, {(stai_ptr) conv_hidden_2_t_in_0_ptr_const_handle});
+    
+  forward_lite_nl_relu_if32of32(conv_hidden_2_t_out_0_ptr_handle, conv_hidden_2_t_in_0_ptr_const_handle, conv_hidden_2_t_in_0_shape_ch_h_prod_const_s32, NULL);
+    
+  _STAI_NETWORK_EVENT_NODE_STOP_CB(7, 1, {(stai_ptr) conv_hidden_2_t_out_0_ptr_handle});
+  }
+    break;
+    case 10: /* batch_normalization_2 */
+  {
+      ai_float* batch_normalization_2_t_out_0_ptr_f32 = (ai_float*)(net_ctx->_activations[0] + 832);
+    const ai_float* batch_normalization_2_t_in_0_ptr_const_f32 = (ai_float*)(net_ctx->_activations[0] + 0);
+    const ai_float* batch_normalization_2_t_weight_0_ptr_const_f32 = (ai_float*)(net_ctx->_weights[0] + 2048);
+    const ai_float* batch_normalization_2_t_weight_1_ptr_const_f32 = (ai_float*)(net_ctx->_weights[0] + 2080);
+  
+  _STAI_NETWORK_EVENT_NODE_START_CB(8, 1, {(stai_ptr) batch_normalization_2_t_in_0_ptr_const_f32});
+    
+  forward_lite_bn_if32of32wf32(batch_normalization_2_t_out_0_ptr_f32, batch_normalization_2_t_in_0_ptr_const_f32, batch_normalization_2_t_weight_0_ptr_const_f32, batch_normalization_2_t_weight_1_ptr_const_f32, (ai_u32)(208), (ai_size)(8));
+    
+  _STAI_NETWORK_EVENT_NODE_STOP_CB(8, 1, {(stai_ptr) batch_normalization_2_t_out_0_ptr_f32});
+  }
+    break;
+    case 11: /* max_pooling1d_2 */
+  {
+    
+  forward_lite_mp_max_pooling1d_2(net_ctx);
+  }
+    break;
+    case 12: /* dense_out */
+  {
+      forward_lite_dense_if32of32wf32_args arg_30f51e = {
+      .output = (float*)(net_ctx->_activations[0] + 416),
+      .input = (float*)(net_ctx->_activations[0] + 0),
+      .weights = (float*)(net_ctx->_weights[0] + 2112),
+      .bias = (float*)(net_ctx->_weights[0] + 3776),
+      .n_channel_in = 104,
+      .n_channel_out = 4,
+      .n_elements = 1,
+    };
+  
+  _STAI_NETWORK_EVENT_NODE_START_CB(11, 1, {(stai_ptr) (float*)(net_ctx->_activations[0] + 0)});
+    
+  forward_lite_dense_if32of32wf32((forward_lite_dense_if32of32wf32_args*)&arg_30f51e);
+    
+  _STAI_NETWORK_EVENT_NODE_STOP_CB(11, 1, {(stai_ptr) (float*)(net_ctx->_activations[0] + 416)});
+  }
+    break;
+    case 13: /* output */
+  {
+      ai_handle output_t_out_0_ptr_handle = (ai_handle)(net_ctx->_outputs[0] + 0);
+    const ai_handle output_t_in_0_ptr_const_handle = (ai_handle)(net_ctx->_activations[0] + 416);
+    const ai_i32 output_t_in_0_shape_ch_prod_const_s32 = 4;
+  
+  _STAI_NETWORK_EVENT_NODE_START_CB(13, 1, {(stai_ptr) output_t_in_0_ptr_const_handle});
+    
+  forward_lite_nl_softmax_if32of32(output_t_out_0_ptr_handle, output_t_in_0_ptr_const_handle, output_t_in_0_shape_ch_prod_const_s32, 1, 4);
+    
+  _STAI_NETWORK_EVENT_NODE_STOP_CB(13, 1, {(stai_ptr) output_t_out_0_ptr_handle});
+  }
+    break;
+    default:
+    break;
+    }
+  }
+
+  return net_ctx->_return_code;
+}
+/* STAI_STEP END */
+
 #undef _STAI_SET_ERROR
 #undef _STAI_CONTEXT_ALIGNMENT
 #undef _STAI_CONTEXT_ACQUIRE
@@ -13,12 +13,26 @@
   */
 
 #include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
 
 #include "network_utils.h"
 
 #include "stai.h"
 #include "network.h"
 
+// inputs and outputs placed inside the activations buffer by stai_plan.py, which may extend it
+#ifndef STAI_NETWORK_PLAN_ACTIVATIONS_SIZE_BYTES
+#define STAI_NETWORK_PLAN_ACTIVATIONS_SIZE_BYTES STAI_NETWORK_ACTIVATIONS_SIZE_BYTES
+#endif
+
+// the offsets are relative to the activations buffer allocated below, the one allocated by the generated code cannot be
+// extended (stai_plan.py does not place the buffers in this case, the network.h file is out of date)
+#if (STAI_NETWORK_FLAGS & STAI_FLAG_ACTIVATIONS) && \
+	(defined(STAI_NETWORK_PLAN_IN_OFFSETS) || defined(STAI_NETWORK_PLAN_OUT_OFFSETS))
+#error "buffers placed by stai_plan.py with activations allocated by ST Edge AI Core, run stai_plan.py again"
+#endif
+
 #define ANY_BUF_ALLOC ( \
 		!(STAI_NETWORK_FLAGS & STAI_FLAG_INPUTS) || \
 		!(STAI_NETWORK_FLAGS & STAI_FLAG_OUTPUTS) || \
@@ -33,18 +47,18 @@
 
 void init_network_buffers(stai_network *net, stai_ptr *input_buffers, stai_ptr *output_buffers)
 {
-#if !(STAI_NETWORK_FLAGS & STAI_FLAG_INPUTS)
+#if !(STAI_NETWORK_FLAGS & STAI_FLAG_INPUTS) && !defined(STAI_NETWORK_PLAN_IN_OFFSETS)
 	static uint8_t inputs_mem[STAI_NETWORK_IN_SIZE_BYTES];
 	const uint32_t input_sizes[STAI_NETWORK_IN_NUM] = STAI_NETWORK_IN_SIZES_BYTES;
 	const uint8_t input_aligns[STAI_NETWORK_IN_NUM] = STAI_NETWORK_IN_ALIGNMENTS;
 #endif
-#if !(STAI_NETWORK_FLAGS & STAI_FLAG_OUTPUTS)
+#if !(STAI_NETWORK_FLAGS & STAI_FLAG_OUTPUTS) && !defined(STAI_NETWORK_PLAN_OUT_OFFSETS)
 	static uint8_t outputs_mem[STAI_NETWORK_OUT_SIZE_BYTES];
 	const uint32_t output_sizes[STAI_NETWORK_OUT_NUM] = STAI_NETWORK_OUT_SIZES_BYTES;
 	const uint8_t output_aligns[STAI_NETWORK_OUT_NUM] = STAI_NETWORK_OUT_ALIGNMENTS;
 #endif
 #if !(STAI_NETWORK_FLAGS & STAI_FLAG_ACTIVATIONS)
-	static uint8_t activations_mem[STAI_NETWORK_ACTIVATIONS_SIZE_BYTES];
+	static uint8_t activations_mem[STAI_NETWORK_PLAN_ACTIVATIONS_SIZE_BYTES];
 	const uint32_t activation_sizes[STAI_NETWORK_ACTIVATIONS_NUM] = STAI_NETWORK_ACTIVATIONS_SIZES;
 	const uint8_t activation_aligns[STAI_NETWORK_ACTIVATIONS_NUM] = STAI_NETWORK_ACTIVATIONS_ALIGNMENTS;
 	stai_ptr activation_buffers[STAI_NETWORK_ACTIVATIONS_NUM];
@@ -65,6 +79,7 @@ void init_network_buffers(stai_network *net, stai_ptr *input_buffers, stai_ptr *
 
 	// set the pointers to the activation, input, output and state buffers if not already allocated
 	// if already allocated in the activation buffer, retrieve pointers to the input and output buffers
+	// if placed in the activation buffer by stai_plan.py, set pointers inside it
 
 #if !(STAI_NETWORK_FLAGS & STAI_FLAG_ACTIVATIONS)
 	curr = (uint32_t)activations_mem;
@@ -84,6 +99,12 @@ void init_network_buffers(stai_network *net, stai_ptr *input_buffers, stai_ptr *
 
 #if (STAI_NETWORK_FLAGS & STAI_FLAG_INPUTS)
 	stai_network_get_inputs(net, input_buffers, &tmp);
+#elif defined(STAI_NETWORK_PLAN_IN_OFFSETS)
+	const uint32_t input_offsets[STAI_NETWORK_IN_NUM] = STAI_NETWORK_PLAN_IN_OFFSETS;
+	for (int8_t i = 0; i < STAI_NETWORK_IN_NUM; i++) {
+		input_buffers[i] = activation_buffers[0] + input_offsets[i];
+	}
+	(void)stai_network_set_inputs(net, input_buffers, STAI_NETWORK_IN_NUM);
 #else
 	curr = (uint32_t)inputs_mem;
 	for (int8_t i = 0; i < STAI_NETWORK_IN_NUM; i++) {
@@ -101,6 +122,12 @@ void init_network_buffers(stai_network *net, stai_ptr *input_buffers, stai_ptr *
 
 #if (STAI_NETWORK_FLAGS & STAI_FLAG_OUTPUTS)
 	stai_network_get_outputs(net, output_buffers, &tmp);
+#elif defined(STAI_NETWORK_PLAN_OUT_OFFSETS)
+	const uint32_t output_offsets[STAI_NETWORK_OUT_NUM] = STAI_NETWORK_PLAN_OUT_OFFSETS;
+	for (int8_t i = 0; i < STAI_NETWORK_OUT_NUM; i++) {
+		output_buffers[i] = activation_buffers[0] + output_offsets[i];
+	}
+	(void)stai_network_set_outputs(net, output_buffers, STAI_NETWORK_OUT_NUM);
 #else
 	curr = (uint32_t)outputs_mem;
 	for (int8_t i = 0; i < STAI_NETWORK_OUT_NUM; i++) {
@@ -132,3 +159,63 @@ void init_network_buffers(stai_network *net, stai_ptr *input_buffers, stai_ptr *
 #endif
 }
 
+void init_input_window(struct input_window *win, float *buf, uint16_t len, uint16_t channels, uint16_t hop)
+{
+	win->buf = buf;
+	win->len = len;
+	win->channels = channels;
+	win->hop = (hop == 0u || hop > len) ? len : hop;
+	win->pos = 0u;
+	win->count = 0u;
+	win->full = false;
+}
+
+bool push_input_window(struct input_window *win, const float *sample)
+{
+	(void)memcpy(&win->buf[(uint32_t)win->pos * win->channels], sample, win->channels * sizeof(float));
+
+	if (++win->pos == win->len) {
+		win->pos = 0u;
+	}
+
+	win->count++;
+	if (win->count < (win->full ? win->hop : win->len)) {
+		return false;
+	}
+
+	win->count = 0u;
+	win->full = true;
+
+	return true;
+}
+
+void copy_input_window(const struct input_window *win, stai_ptr input)
+{
+	// the window wraps around the end of the ring buffer, the oldest samples are from pos to the end
+	uint32_t sample_size = win->channels * sizeof(float);
+	uint32_t older = (uint32_t)(win->len - win->pos) * sample_size;
+
+	(void)memcpy(input, &win->buf[(uint32_t)win->pos * win->channels], older);
+	(void)memcpy(input + older, win->buf, (uint32_t)win->pos * sample_size);
+}
+
+#ifdef STAI_NETWORK_RUN_NODES
+stai_return_code run_network_step(stai_network *net, stai_size *node, stai_size max_nodes)
+{
+	if (*node >= STAI_NETWORK_NODES_NUM) {
+		return STAI_SUCCESS;
+	}
+
+	stai_size num = STAI_NETWORK_NODES_NUM - *node;
+	if (num > max_nodes) {
+		num = max_nodes;
+	}
+
+	stai_return_code res = stai_network_run_nodes(net, *node, num);
+
+	// on error, the inference is aborted
+	*node = (res == STAI_SUCCESS) ? (*node + num) : STAI_NETWORK_NODES_NUM;
+
+	return res;
+}
+#endif
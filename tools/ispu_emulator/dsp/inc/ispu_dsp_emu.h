@@ -0,0 +1,104 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+// ISPU instructions used by the host versions of the ISPU DSP library, so that the results match the ones of the
+// device (including the order of the floating-point operations)
+
+#ifndef ISPU_DSP_EMU_H
+#define ISPU_DSP_EMU_H
+
+#include <stdint.h>
+#include <string.h>
+
+#include "peripherals.h"
+#include "reg_map.h"
+#include "ispu_emu_cost.h"
+
+// maximum number of iterations of a zero overhead loop
+#define ZOL_MAX_ITER 1024u
+
+// accumulator of the acms instruction
+struct acms_acc {
+	float r0;
+	float r1;
+};
+
+// acms a, b: r0 += r1, r1 = a * b (the last product must be added with r0 += r1 at the end)
+static inline void acms(struct acms_acc *acc, float a, float b)
+{
+	acc->r0 += acc->r1;
+	acc->r1 = a * b;
+}
+
+static inline uint32_t float_bits(float x)
+{
+	uint32_t bits;
+	memcpy(&bits, &x, sizeof(bits));
+
+	return bits;
+}
+
+static inline float bits_float(uint32_t bits)
+{
+	float x;
+	memcpy(&x, &bits, sizeof(x));
+
+	return x;
+}
+
+// fmax a, b: a = a > b ? a : b
+static inline float fmax_isa(float a, float b)
+{
+	return a > b ? a : b;
+}
+
+// fmin a, b: a = a < b ? a : b
+static inline float fmin_isa(float a, float b)
+{
+	return a < b ? a : b;
+}
+
+// bclear x, #31
+static inline float fabs_isa(float x)
+{
+	return bits_float(float_bits(x) & 0x7FFFFFFFu);
+}
+
+// fsubs x, y followed by srlw x, #31: 1 if x < y
+static inline uint32_t less_isa(float x, float y)
+{
+	return float_bits(x - y) >> 31;
+}
+
+// square root computed by the hardware accelerator
+static inline float hw_sqrtf(float x)
+{
+	cast_float(ISPU_SQRT_I) = x;
+
+	return cast_float(ISPU_SQRT_O);
+}
+
+// inverse of a positive number: initial approximation from the bits of the number, then 3 Newton iterations
+static inline float inv_newton(float s)
+{
+	float y = bits_float(0x7EF311C3u - float_bits(s));
+
+	for (uint8_t i = 0; i < 3u; i++)
+		y = y * (2.0f - s * y);
+
+	return y;
+}
+
+#endif
+
@@ -0,0 +1,29 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+// host version of ispu_add_f32.S
+
+#include "ispu_dsp.h"
+#include "ispu_dsp_emu.h"
+
+#include <stdint.h>
+
+void ispu_add_f32(const float *src0, const float *src1, float *dst, uint32_t block_size)
+{
+	for (uint32_t i = 0; i < block_size; i++)
+		dst[i] = src0[i] + src1[i];
+
+	ispu_emu_charge(ISPU_EMU_COST_ADD_F32, block_size, 0);
+}
+
@@ -0,0 +1,29 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+// host version of ispu_clip_f32.S
+
+#include "ispu_dsp.h"
+#include "ispu_dsp_emu.h"
+
+#include <stdint.h>
+
+void ispu_clip_f32(const float *src, float *dst, float low, float high, uint32_t block_size)
+{
+	for (uint32_t i = 0; i < block_size; i++)
+		dst[i] = fmin_isa(fmax_isa(src[i], low), high);
+
+	ispu_emu_charge(ISPU_EMU_COST_CLIP_F32, block_size, 0);
+}
+
@@ -0,0 +1,40 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+// host version of ispu_normalize4_f32.S, using the square root accelerator
+
+#include "ispu_dsp.h"
+#include "ispu_dsp_emu.h"
+
+#include <stdint.h>
+
+// minimum norm, to avoid the division by zero
+#define MIN_NORM 1e-18f
+
+void ispu_normalize4_f32(const float *src, float *dst, uint32_t block_size)
+{
+	for (uint32_t i = 0; i < block_size; i++) {
+		const float *v = &src[4u * i];
+		float sum = v[0] * v[0];
+		for (uint8_t j = 1; j < 4u; j++)
+			sum += v[j] * v[j];
+
+		float inv = inv_newton(fmax_isa(hw_sqrtf(sum), MIN_NORM));
+		for (uint8_t j = 0; j < 4u; j++)
+			dst[4u * i + j] = v[j] * inv;
+	}
+
+	ispu_emu_charge(ISPU_EMU_COST_NORMALIZE4_F32, block_size, 0);
+}
+
@@ -0,0 +1,29 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+// host version of ispu_cmplx_mag_f32.S, using the square root accelerator
+
+#include "ispu_dsp.h"
+#include "ispu_dsp_emu.h"
+
+#include <stdint.h>
+
+void ispu_cmplx_mag_f32(const float *src, float *dst, uint32_t block_size)
+{
+	for (uint32_t i = 0; i < block_size; i++)
+		dst[i] = hw_sqrtf(src[2u * i] * src[2u * i] + src[2u * i + 1u] * src[2u * i + 1u]);
+
+	ispu_emu_charge(ISPU_EMU_COST_CMPLX_MAG_F32, block_size, 0);
+}
+
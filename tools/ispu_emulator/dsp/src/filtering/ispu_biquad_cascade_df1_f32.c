@@ -0,0 +1,59 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+// host version of ispu_biquad_cascade_df1_f32.S
+
+#include "ispu_dsp.h"
+#include "ispu_dsp_emu.h"
+
+#include <stdint.h>
+
+void ispu_biquad_cascade_df1_f32(const struct ispu_biquad_casd_df1_inst_f32 *inst, const float *src, float *dst,
+                                 uint32_t block_size)
+{
+	for (uint8_t stage = 0; stage < inst->num_stages; stage++) {
+		const float *coeffs = &inst->coeffs[5u * stage];
+		float *state = &inst->state[4u * stage];
+		float x1 = state[0], x2 = state[1], y1 = state[2], y2 = state[3];
+
+		for (uint32_t i = 0; i < block_size; i++) {
+			struct acms_acc acc = { 0.0f, 0.0f };
+			float x = src[i];
+
+			acms(&acc, x, coeffs[0]);
+			acms(&acc, x1, coeffs[1]);
+			acms(&acc, x2, coeffs[2]);
+			acms(&acc, y1, coeffs[3]);
+			acms(&acc, y2, coeffs[4]);
+			float y = acc.r0 + acc.r1;
+
+			x2 = x1;
+			x1 = x;
+			y2 = y1;
+			y1 = y;
+			dst[i] = y;
+		}
+
+		state[0] = x1;
+		state[1] = x2;
+		state[2] = y1;
+		state[3] = y2;
+
+		// the input of the next stage is the output of the previous one
+		src = dst;
+	}
+
+	ispu_emu_charge(ISPU_EMU_COST_BIQUAD_CASCADE_DF1_F32, block_size * inst->num_stages, inst->num_stages);
+}
+
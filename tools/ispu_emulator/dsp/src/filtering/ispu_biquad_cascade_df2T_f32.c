@@ -0,0 +1,54 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+// host version of ispu_biquad_cascade_df2T_f32.S
+
+#include "ispu_dsp.h"
+#include "ispu_dsp_emu.h"
+
+#include <stdint.h>
+
+void ispu_biquad_cascade_df2T_f32(const struct ispu_biquad_casd_df2T_inst_f32 *inst, const float *src, float *dst,
+                                  uint32_t block_size)
+{
+	for (uint8_t stage = 0; stage < inst->num_stages; stage++) {
+		const float *coeffs = &inst->coeffs[5u * stage];
+		float *state = &inst->state[2u * stage];
+		float d1 = state[0], d2 = state[1];
+
+		for (uint32_t i = 0; i < block_size; i++) {
+			struct acms_acc acc = { 0.0f, d1 };
+			float x = src[i];
+
+			acms(&acc, x, coeffs[0]);
+			acms(&acc, x, coeffs[1]);
+			float y = acc.r0; // b0 * x + d1
+			dst[i] = y;
+
+			acc.r0 = y * coeffs[3];
+			acms(&acc, x, coeffs[2]);
+			d1 = acc.r0 + d2; // b1 * x + a1 * y + d2
+			d2 = y * coeffs[4] + acc.r1; // b2 * x + a2 * y
+		}
+
+		state[0] = d1;
+		state[1] = d2;
+
+		// the input of the next stage is the output of the previous one
+		src = dst;
+	}
+
+	ispu_emu_charge(ISPU_EMU_COST_BIQUAD_CASCADE_DF2T_F32, block_size * inst->num_stages, inst->num_stages);
+}
+
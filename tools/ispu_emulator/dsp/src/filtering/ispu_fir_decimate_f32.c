@@ -0,0 +1,61 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+// host version of ispu_fir_decimate_f32_small.S and ispu_fir_decimate_f32_big.S
+
+#include "ispu_dsp.h"
+#include "ispu_dsp_emu.h"
+#include "internal/ispu_fir_decimate_f32.h"
+
+#include <stdint.h>
+
+static void fir_decimate_f32(const struct ispu_fir_decimate_instance_f32 *inst, const float *src, float *dst,
+                             uint32_t block_size)
+{
+	uint16_t num_taps = inst->num_taps;
+	uint8_t dec = inst->dec;
+	float *state = inst->state;
+	uint32_t out = 0;
+
+	for (uint32_t i = 0; i < block_size; i += dec) {
+		// dec new samples are appended to the state, then one output is computed from the oldest sample
+		for (uint8_t k = 0; k < dec; k++)
+			state[num_taps - 1u + i + k] = src[i + k];
+
+		struct acms_acc acc = { 0.0f, 0.0f };
+		for (uint16_t j = 0; j < num_taps; j++)
+			acms(&acc, state[i + j], inst->coeffs[j]);
+
+		dst[out++] = acc.r0 + acc.r1;
+	}
+
+	// the last num_taps - 1 samples are kept for the next call
+	for (uint16_t j = 0; j + 1u < num_taps; j++)
+		state[j] = state[block_size + j];
+
+	ispu_emu_charge(ISPU_EMU_COST_FIR_DECIMATE_F32, out, out * num_taps + block_size + num_taps - 1u);
+}
+
+void ispu_fir_decimate_f32_small(const struct ispu_fir_decimate_instance_f32 *inst, const float *src, float *dst,
+                                 uint32_t block_size)
+{
+	fir_decimate_f32(inst, src, dst, block_size);
+}
+
+void ispu_fir_decimate_f32_big(const struct ispu_fir_decimate_instance_f32 *inst, const float *src, float *dst,
+                               uint32_t block_size)
+{
+	fir_decimate_f32(inst, src, dst, block_size);
+}
+
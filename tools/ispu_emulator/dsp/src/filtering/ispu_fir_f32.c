@@ -0,0 +1,55 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+// host version of ispu_fir_f32_small.S and ispu_fir_f32_big.S
+
+#include "ispu_dsp.h"
+#include "ispu_dsp_emu.h"
+#include "internal/ispu_fir_f32.h"
+
+#include <stdint.h>
+
+static void fir_f32(const struct ispu_fir_instance_f32 *inst, const float *src, float *dst, uint32_t block_size)
+{
+	uint16_t num_taps = inst->num_taps;
+	float *state = inst->state;
+
+	for (uint32_t i = 0; i < block_size; i++) {
+		// the new sample is appended to the state, then the products are accumulated starting from the oldest sample
+		state[num_taps - 1u + i] = src[i];
+
+		struct acms_acc acc = { 0.0f, 0.0f };
+		for (uint16_t j = 0; j < num_taps; j++)
+			acms(&acc, state[i + j], inst->coeffs[j]);
+
+		dst[i] = acc.r0 + acc.r1;
+	}
+
+	// the last num_taps - 1 samples are kept for the next call
+	for (uint16_t j = 0; j + 1u < num_taps; j++)
+		state[j] = state[block_size + j];
+
+	ispu_emu_charge(ISPU_EMU_COST_FIR_F32, block_size, block_size * num_taps + num_taps - 1u);
+}
+
+void ispu_fir_f32_small(const struct ispu_fir_instance_f32 *inst, const float *src, float *dst, uint32_t block_size)
+{
+	fir_f32(inst, src, dst, block_size);
+}
+
+void ispu_fir_f32_big(const struct ispu_fir_instance_f32 *inst, const float *src, float *dst, uint32_t block_size)
+{
+	fir_f32(inst, src, dst, block_size);
+}
+
@@ -0,0 +1,70 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+// host version of ispu_fir_f32_opt_odd.S and ispu_fir_f32_opt_even.S, using the circular buffer accelerator
+
+#include "ispu_dsp.h"
+#include "internal/ispu_fir_f32.h"
+#include "peripherals.h"
+#include "reg_map.h"
+#include "ispu_emu_cost.h"
+
+#include <stdint.h>
+
+static void fir_f32_opt(const struct ispu_fir_instance_f32_opt *inst, const float *src, float *dst, uint32_t block_size)
+{
+	// save the accelerator registers
+	uint32_t start = cast_uint32_t(ISPU_CIRCULAR_START);
+	uint32_t end = cast_uint32_t(ISPU_CIRCULAR_END);
+	uint32_t curr = cast_uint32_t(ISPU_CIRCULAR_CURR);
+	uint32_t stride = cast_uint32_t(ISPU_CIRCULAR_STRIDE);
+
+	cast_uint32_t(ISPU_CIRCULAR_START) = (uint32_t)(uintptr_t)inst->state;
+	cast_uint32_t(ISPU_CIRCULAR_END) = (uint32_t)(uintptr_t)&inst->state[inst->num_taps];
+	cast_uint32_t(ISPU_CIRCULAR_CURR) = (uint32_t)(uintptr_t)inst->state_curr;
+	cast_uint32_t(ISPU_CIRCULAR_STRIDE) = 0u;
+
+	for (uint32_t i = 0; i < block_size; i++) {
+		// the new sample replaces the oldest one, then the buffer is read starting from the oldest sample
+		cast_float(ISPU_CIRCULAR_MATCH) = src[i];
+
+		float acc = 0.0f;
+		for (uint16_t j = 0; j < inst->num_taps; j++)
+			acc += cast_float(ISPU_CIRCULAR_MATCH) * inst->coeffs[j];
+
+		dst[i] = acc;
+	}
+
+	// as on the device, the offset read from ISPU_CIRCULAR_CURR is stored in the instance
+	((struct ispu_fir_instance_f32_opt *)inst)->state_curr = (float *)(uintptr_t)cast_uint32_t(ISPU_CIRCULAR_CURR);
+
+	// restore the accelerator registers
+	cast_uint32_t(ISPU_CIRCULAR_STRIDE) = stride;
+	cast_uint32_t(ISPU_CIRCULAR_CURR) = curr;
+	cast_uint32_t(ISPU_CIRCULAR_END) = end;
+	cast_uint32_t(ISPU_CIRCULAR_START) = start;
+
+	ispu_emu_charge(ISPU_EMU_COST_FIR_F32_OPT, block_size, block_size * inst->num_taps);
+}
+
+void ispu_fir_f32_opt_odd(const struct ispu_fir_instance_f32_opt *inst, const float *src, float *dst, uint32_t block_size)
+{
+	fir_f32_opt(inst, src, dst, block_size);
+}
+
+void ispu_fir_f32_opt_even(const struct ispu_fir_instance_f32_opt *inst, const float *src, float *dst, uint32_t block_size)
+{
+	fir_f32_opt(inst, src, dst, block_size);
+}
+
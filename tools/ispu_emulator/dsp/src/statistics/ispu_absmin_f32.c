@@ -0,0 +1,40 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+// host version of ispu_absmin_f32.S
+
+#include "ispu_dsp.h"
+#include "ispu_dsp_emu.h"
+
+#include <stdint.h>
+
+void ispu_absmin_f32(const float *src, float *res, uint32_t *idx, uint32_t block_size)
+{
+	float val = bits_float(0x7F800000u); // +Inf
+	uint32_t pos = block_size - 1u;
+
+	// as on the device, the vector is scanned backwards so that the index of the first occurrence is returned
+	for (uint32_t i = block_size; i-- > 0u;) {
+		float x = fabs_isa(src[i]);
+		val = fmin_isa(val, x);
+		if (float_bits(val) == float_bits(x))
+			pos = i;
+	}
+
+	*res = val;
+	*idx = pos;
+
+	ispu_emu_charge(ISPU_EMU_COST_ABSMIN_F32, block_size, 0);
+}
+
@@ -0,0 +1,33 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+// host version of ispu_accumulate_f32.S
+
+#include "ispu_dsp.h"
+#include "ispu_dsp_emu.h"
+
+#include <stdint.h>
+
+void ispu_accumulate_f32(const float *src, float *res, uint32_t block_size)
+{
+	float sum = 0.0f;
+
+	for (uint32_t i = 0; i < block_size; i++)
+		sum += src[i];
+
+	*res = sum;
+
+	ispu_emu_charge(ISPU_EMU_COST_ACCUMULATE_F32, block_size, 0);
+}
+
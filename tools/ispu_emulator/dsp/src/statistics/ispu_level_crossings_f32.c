@@ -0,0 +1,40 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+// host version of ispu_level_crossings_f32.S
+
+#include "ispu_dsp.h"
+#include "ispu_dsp_emu.h"
+
+#include <stdint.h>
+
+void ispu_level_crossings_f32(const float *src, float level, uint32_t *res, uint32_t block_size, uint32_t stride)
+{
+	uint32_t crossings = 0;
+
+	if (block_size >= 2u) {
+		uint32_t prev = less_isa(src[0], level);
+
+		for (uint32_t i = 1; i < block_size; i++) {
+			uint32_t below = less_isa(src[i * stride], level);
+			crossings += below ^ prev;
+			prev = below;
+		}
+	}
+
+	*res = crossings;
+
+	ispu_emu_charge(ISPU_EMU_COST_LEVEL_CROSSINGS_F32, block_size, 0);
+}
+
@@ -0,0 +1,31 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+// host version of ispu_mean_f32.S
+
+#include "ispu_dsp.h"
+#include "ispu_dsp_emu.h"
+
+#include <stdint.h>
+
+void ispu_mean_f32(const float *src, float *res, uint32_t block_size)
+{
+	ispu_accumulate_f32(src, res, block_size);
+	*res = *res / (float)block_size;
+
+	ispu_emu_charge(ISPU_EMU_COST_MEAN_F32, block_size, 0);
+	ispu_emu_charge(ISPU_EMU_COST_FLOATSISF, 0, 0);
+	ispu_emu_charge(ISPU_EMU_COST_DIVSF3, 0, 0);
+}
+
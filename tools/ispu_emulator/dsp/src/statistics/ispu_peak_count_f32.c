@@ -0,0 +1,40 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+// host version of ispu_peak_count_f32.S
+
+#include "ispu_dsp.h"
+#include "ispu_dsp_emu.h"
+
+#include <stdint.h>
+
+void ispu_peak_count_f32(const float *src, float low, float high, uint32_t *res, uint32_t block_size, uint32_t stride)
+{
+	uint32_t peaks = 0;
+	uint32_t armed = 0; // set once the signal goes below low
+
+	for (uint32_t i = 0; i < block_size; i++) {
+		float x = src[i * stride];
+		uint32_t below = less_isa(x, high);
+		uint32_t reset = less_isa(x, low);
+
+		peaks += armed & (below ^ 1u);
+		armed = reset | (armed & below);
+	}
+
+	*res = peaks;
+
+	ispu_emu_charge(ISPU_EMU_COST_PEAK_COUNT_F32, block_size, 0);
+}
+
@@ -0,0 +1,37 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+// host version of ispu_power_f32.S
+
+#include "ispu_dsp.h"
+#include "ispu_dsp_emu.h"
+
+#include <stdint.h>
+
+void ispu_power_f32(const float *src, float *res, uint32_t block_size)
+{
+	struct acms_acc acc = { 0.0f, 0.0f };
+
+	// as on the device, the last product of each loop of 1024 iterations is added twice
+	for (uint32_t i = 0; i < block_size; i++) {
+		acms(&acc, src[i], src[i]);
+		if ((i + 1u) % ZOL_MAX_ITER == 0u || i + 1u == block_size)
+			acc.r0 += acc.r1;
+	}
+
+	*res = acc.r0;
+
+	ispu_emu_charge(ISPU_EMU_COST_POWER_F32, block_size, 0);
+}
+
@@ -0,0 +1,43 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+// host version of ispu_var_f32.S
+
+#include "ispu_dsp.h"
+#include "ispu_dsp_emu.h"
+
+#include <stdint.h>
+
+void ispu_var_f32(const float *src, float *res, uint32_t block_size)
+{
+	ispu_mean_f32(src, res, block_size);
+
+	float mean = *res;
+	struct acms_acc acc = { 0.0f, 0.0f };
+
+	// as on the device, the last product of each loop of 1024 iterations is added twice
+	for (uint32_t i = 0; i < block_size; i++) {
+		float diff = src[i] - mean;
+		acms(&acc, diff, diff);
+		if ((i + 1u) % ZOL_MAX_ITER == 0u || i + 1u == block_size)
+			acc.r0 += acc.r1;
+	}
+
+	*res = acc.r0 / (float)(block_size - 1u);
+
+	ispu_emu_charge(ISPU_EMU_COST_VAR_F32, block_size, 0);
+	ispu_emu_charge(ISPU_EMU_COST_FLOATSISF, 0, 0);
+	ispu_emu_charge(ISPU_EMU_COST_DIVSF3, 0, 0);
+}
+
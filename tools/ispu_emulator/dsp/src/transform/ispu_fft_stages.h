@@ -0,0 +1,122 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+// steps shared by the host versions of ispu_rfft_f32.S and ispu_irfft_f32.S
+
+#ifndef ISPU_FFT_STAGES_H
+#define ISPU_FFT_STAGES_H
+
+#include "ispu_dsp.h"
+#include "peripherals.h"
+#include "reg_map.h"
+
+#include <stdint.h>
+
+// bit reverse addressing stage, the first and the last complex numbers do not need bit reversing
+static inline void fft_bit_reverse(const struct ispu_rfft_instance_f32 *inst, float *data)
+{
+	cast_uint32_t(ISPU_FFT_N_ELEM_BRA) = inst->fft_n_elem_bra;
+	cast_uint32_t(ISPU_FFT_CURR_BRA) = (uint32_t)(uintptr_t)&data[2];
+
+	for (uint16_t i = 0; i < inst->fft_len / 2u - 2u; i++) {
+		for (uint8_t j = 0; j < 2u; j++) {
+			float x = cast_float(ISPU_FFT_MATCH_BRA);
+			float x_ra = cast_float(ISPU_FFT_MATCH_BRA);
+			cast_float(ISPU_FFT_MATCH_BRA) = x;
+			cast_float(ISPU_FFT_MATCH_BRA) = x_ra;
+		}
+	}
+}
+
+// stage 1 (twiddle factor is 1 + 0j) and stage 2 (twiddle factors are 1 + 0j, 0 - 1j)
+static inline void fft_first_stages(const struct ispu_rfft_instance_f32 *inst, float *data)
+{
+	for (float *x = data; x < &data[inst->fft_len]; x += 4) {
+		float re = x[0];
+		float im = x[1];
+		x[0] = re + x[2];
+		x[1] = im + x[3];
+		x[2] = re - x[2];
+		x[3] = im - x[3];
+	}
+
+	cast_uint32_t(ISPU_FFT_TWIDDLE) = 2u;
+	cast_uint32_t(ISPU_FFT_CURR_D1) = (uint32_t)(uintptr_t)data;
+
+	for (uint16_t i = 0; i < inst->fft_len / 8u; i++) {
+		float d1_re = cast_float(ISPU_FFT_MATCH_D);
+		float d1_im = cast_float(ISPU_FFT_MATCH_D);
+		float d2_re = cast_float(ISPU_FFT_MATCH_D);
+		float d2_im = cast_float(ISPU_FFT_MATCH_D);
+		cast_float(ISPU_FFT_MATCH_D) = d1_re + d2_re;
+		cast_float(ISPU_FFT_MATCH_D) = d1_im + d2_im;
+		cast_float(ISPU_FFT_MATCH_D) = d1_re - d2_re;
+		cast_float(ISPU_FFT_MATCH_D) = d1_im - d2_im;
+
+		d1_re = cast_float(ISPU_FFT_MATCH_D);
+		d1_im = cast_float(ISPU_FFT_MATCH_D);
+		d2_re = cast_float(ISPU_FFT_MATCH_D);
+		d2_im = cast_float(ISPU_FFT_MATCH_D);
+		cast_float(ISPU_FFT_MATCH_D) = d1_re + d2_im;
+		cast_float(ISPU_FFT_MATCH_D) = d1_im - d2_re;
+		cast_float(ISPU_FFT_MATCH_D) = d1_re - d2_im;
+		cast_float(ISPU_FFT_MATCH_D) = d1_im + d2_re;
+	}
+}
+
+// generic butterfly stage, the outputs are multiplied by scale_re (real part) and scale_im (imaginary part)
+static inline void fft_stage(const struct ispu_rfft_instance_f32 *inst, float *data, uint16_t num_twiddles,
+                             float scale_re, float scale_im)
+{
+	uint32_t twiddle_table = (uint32_t)(uintptr_t)inst->twiddle_table;
+
+	cast_uint32_t(ISPU_FFT_START_TW) = twiddle_table;
+	cast_uint32_t(ISPU_FFT_CURR_TW1) = twiddle_table;
+	cast_uint32_t(ISPU_FFT_END_TW) = twiddle_table + inst->fft_len;
+	cast_uint32_t(ISPU_FFT_CURR_TW2) = twiddle_table + inst->fft_len;
+	cast_uint32_t(ISPU_FFT_TWIDDLE) = num_twiddles;
+	cast_uint32_t(ISPU_FFT_CURR_D1) = (uint32_t)(uintptr_t)data;
+
+	for (uint16_t i = 0; i < inst->fft_len / 4u; i++) {
+		float d1_re = cast_float(ISPU_FFT_MATCH_D);
+		float d1_im = cast_float(ISPU_FFT_MATCH_D);
+		float w_re = cast_float(ISPU_FFT_MATCH_TW);
+		float w_im = cast_float(ISPU_FFT_MATCH_TW);
+		float d2_re = cast_float(ISPU_FFT_MATCH_D);
+		float d2_im = cast_float(ISPU_FFT_MATCH_D);
+
+		float t_re = d2_re * w_re - d2_im * w_im;
+		float t_im = d2_re * w_im + d2_im * w_re;
+
+		cast_float(ISPU_FFT_MATCH_D) = (d1_re + t_re) * scale_re;
+		cast_float(ISPU_FFT_MATCH_D) = (d1_im + t_im) * scale_im;
+		cast_float(ISPU_FFT_MATCH_D) = (d1_re - t_re) * scale_re;
+		cast_float(ISPU_FFT_MATCH_D) = (d1_im - t_im) * scale_im;
+	}
+}
+
+// twiddle factors of the split (real FFT) and merge (inverse real FFT) stages
+static inline void fft_split_twiddles(const struct ispu_rfft_instance_f32 *inst)
+{
+	uint32_t twiddle_table = (uint32_t)(uintptr_t)inst->twiddle_table;
+
+	cast_uint32_t(ISPU_FFT_START_TW) = twiddle_table;
+	cast_uint32_t(ISPU_FFT_CURR_TW1) = twiddle_table;
+	cast_uint32_t(ISPU_FFT_END_TW) = twiddle_table + inst->fft_len;
+	cast_uint32_t(ISPU_FFT_CURR_TW2) = twiddle_table + inst->fft_len;
+	cast_uint32_t(ISPU_FFT_STRIDE_TW) = 0x201u; // stride 1 and bit 9 set for the split / merge stage
+}
+
+#endif
+
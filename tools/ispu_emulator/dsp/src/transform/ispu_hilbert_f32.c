@@ -0,0 +1,48 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+// host version of ispu_hilbert_f32.S
+
+#include "ispu_dsp.h"
+#include "ispu_dsp_emu.h"
+
+#include <stdint.h>
+
+void ispu_hilbert_f32(struct ispu_hilbert_instance_f32 *inst, float *src, float *dst)
+{
+	uint16_t len = inst->hilbert_len;
+
+	// the real part of the analytic signal is the input signal
+	for (uint16_t i = 0; i < len; i++)
+		dst[2u * i] = src[i];
+
+	// the imaginary part is obtained by shifting the phase of the spectrum by -90 degrees (the input is overwritten)
+	ispu_rfft_f32(&inst->rfft_inst, src);
+
+	for (uint16_t i = 0; i < len / 2u; i++) {
+		float re = src[2u * i];
+		src[2u * i] = src[2u * i + 1u];
+		src[2u * i + 1u] = bits_float(float_bits(re) ^ 0x80000000u);
+	}
+	src[0] = 0.0f;
+	src[1] = 0.0f;
+
+	ispu_irfft_f32(&inst->rfft_inst, src);
+
+	for (uint16_t i = 0; i < len; i++)
+		dst[2u * i + 1u] = src[i];
+
+	ispu_emu_charge(ISPU_EMU_COST_HILBERT_F32, len, 0);
+}
+
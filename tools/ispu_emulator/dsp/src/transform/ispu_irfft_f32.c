@@ -0,0 +1,87 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+// host version of ispu_irfft_f32.S, using the FFT address generators
+
+#include "ispu_dsp.h"
+#include "peripherals.h"
+#include "reg_map.h"
+#include "ispu_emu_cost.h"
+
+#include <stdint.h>
+
+#include "ispu_fft_stages.h"
+
+void ispu_irfft_f32(struct ispu_rfft_instance_f32 *inst, float *data)
+{
+	uint16_t fft_len = inst->fft_len;
+
+	// merge stage: build the conjugate of the spectrum of the complex signal from the spectrum of the real signal
+	fft_split_twiddles(inst);
+
+	float *x = data;
+	float *xk = &data[fft_len - 2u];
+	// w(0) is not used, reading it moves the twiddle factor pointers forward
+	(void)cast_float(ISPU_FFT_MATCH_TW);
+	(void)cast_float(ISPU_FFT_MATCH_TW);
+
+	float re = x[0];
+	float im = x[1];
+	x[1] = -((re - im) * 0.5f);
+	x[0] = (re + im) * 0.5f;
+	x += 2;
+
+	// N = fft_len / 2, i from 1 to N / 2 - 1 index of complex numbers, k = N - i
+	for (uint16_t i = 1; i < fft_len / 4u; i++) {
+		float re_sum = xk[0] + x[0];
+		float re_diff = x[0] - xk[0];
+		float w_im = cast_float(ISPU_FFT_MATCH_TW);
+		float w_re = cast_float(ISPU_FFT_MATCH_TW);
+		float f1 = re_diff * w_im;
+		float f2 = re_diff * w_re;
+		float im_diff = x[1] - xk[1];
+		float im_sum = x[1] + xk[1];
+		float f3 = w_re * im_sum;
+		float f4 = im_sum * w_im;
+		float f24 = f2 + f4;
+		float f13 = f1 - f3;
+
+		x[1] = -((f13 + im_diff) * 0.5f);
+		xk[1] = (im_diff - f13) * 0.5f;
+		x[0] = (re_sum - f24) * 0.5f;
+		xk[0] = (re_sum + f24) * 0.5f;
+
+		x += 2;
+		xk -= 2;
+	}
+
+	fft_bit_reverse(inst, data);
+	fft_first_stages(inst, data);
+
+	// intermediate stages, the number of twiddle factors doubles and the stride halves at each stage
+	uint16_t num_twiddles = 4u;
+	cast_uint32_t(ISPU_FFT_STRIDE_TW) = fft_len / 8u;
+	for (uint8_t stage = 0; stage < inst->fft_n_elem_bra + 1u; stage++) {
+		fft_stage(inst, data, num_twiddles, 1.0f, 1.0f);
+		cast_uint32_t(ISPU_FFT_STRIDE_TW) = cast_uint32_t(ISPU_FFT_STRIDE_TW) >> 1;
+		num_twiddles <<= 1;
+	}
+
+	// last stage: conjugation and scaling by 2 / fft_len are also applied
+	float scale = 2.0f / (float)fft_len;
+	fft_stage(inst, data, num_twiddles, scale, -scale);
+
+	ispu_emu_charge(ISPU_EMU_COST_IRFFT_F32, fft_len / 2u, (inst->fft_n_elem_bra + 2u) * (fft_len / 4u));
+}
+
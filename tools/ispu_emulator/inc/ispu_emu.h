@@ -0,0 +1,63 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#ifndef ISPU_EMU_H
+#define ISPU_EMU_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// addresses below this value are ISPU registers, anything else is host memory
+#define ISPU_EMU_REG_SPACE 0x100000u
+
+// maximum number of algorithms that can be dispatched
+#define ISPU_EMU_MAX_ALGOS 30u
+
+struct ispu_emu_stats {
+	uint64_t start_pulses; // number of time slots executed
+	uint64_t algo_calls[ISPU_EMU_MAX_ALGOS]; // number of algo_NN calls (init excluded)
+	uint64_t algo_ns[ISPU_EMU_MAX_ALGOS]; // host time spent in algo_NN [ns]
+	uint64_t algo_cycles[ISPU_EMU_MAX_ALGOS]; // estimated ISPU cycles spent in algo_NN
+	uint64_t algo_cycles_max[ISPU_EMU_MAX_ALGOS]; // estimated ISPU cycles of the longest algo_NN call
+	uint64_t data_valid_calls; // number of data_valid_interrupt calls
+	uint64_t data_valid_cycles; // estimated ISPU cycles spent in data_valid_interrupt
+	bool sens_sleep; // set_sens_sleep executed
+};
+
+extern uint8_t ispu_emu_regs[ISPU_EMU_REG_SPACE];
+extern struct ispu_emu_stats ispu_emu_stats;
+
+// called by the cast_* macros before every register or memory access
+volatile void *ispu_emu_map(uintptr_t addr);
+
+// model of the hardware accelerators, returns NULL if the address is not an accelerator port
+volatile void *ispu_emu_accel(uint32_t addr);
+
+// called by the ISPU program
+void ispu_emu_wait_start_pulse(void);
+void ispu_emu_sens_sleep(void);
+
+// called when the program releases INT2 after driving it low (e.g. to measure the execution time of some code)
+void ispu_emu_int2_pulse(uint64_t cycles);
+
+// called by the driver
+void ispu_emu_boot(void);
+void ispu_emu_start_pulse(void);
+void ispu_emu_data_valid(void);
+
+uint32_t ispu_emu_read(uint32_t addr, uint8_t size);
+void ispu_emu_write(uint32_t addr, uint32_t val, uint8_t size);
+
+#endif
+
@@ -0,0 +1,142 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+// estimation of the number of ISPU cycles spent by the program
+//
+// the functions of the ISPU DSP library and the helpers of the compiler and math library are charged with the costs
+// of a table, while the rest of the program is charged per basic block, according to the number of host instructions
+
+#ifndef ISPU_EMU_COST_H
+#define ISPU_EMU_COST_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+enum ispu_emu_cost_id {
+	// instruction of the program, helpers excluded
+	ISPU_EMU_COST_INSTR,
+
+	// compiler helpers
+	ISPU_EMU_COST_DIVSF3,
+	ISPU_EMU_COST_CMPSF2,
+	ISPU_EMU_COST_FLOATSISF,
+	ISPU_EMU_COST_FIXSFSI,
+	ISPU_EMU_COST_DOUBLE,
+	ISPU_EMU_COST_DIVSI3,
+
+	// math library
+	ISPU_EMU_COST_SQRTF,
+	ISPU_EMU_COST_EXPF,
+	ISPU_EMU_COST_LOGF,
+	ISPU_EMU_COST_LOG10F,
+	ISPU_EMU_COST_POWF,
+	ISPU_EMU_COST_SINF,
+	ISPU_EMU_COST_COSF,
+	ISPU_EMU_COST_TANF,
+	ISPU_EMU_COST_ASINF,
+	ISPU_EMU_COST_ACOSF,
+	ISPU_EMU_COST_ATANF,
+	ISPU_EMU_COST_ATAN2F,
+	ISPU_EMU_COST_TANHF,
+	ISPU_EMU_COST_EXP,
+	ISPU_EMU_COST_LOG,
+	ISPU_EMU_COST_POW,
+	ISPU_EMU_COST_SIN,
+	ISPU_EMU_COST_COS,
+	ISPU_EMU_COST_ATAN2,
+
+	// ISPU DSP library
+	ISPU_EMU_COST_ABS_F32,
+	ISPU_EMU_COST_ADD_F32,
+	ISPU_EMU_COST_CLIP_F32,
+	ISPU_EMU_COST_INV_NORM3_F32,
+	ISPU_EMU_COST_MULT_F32,
+	ISPU_EMU_COST_NEGATE_F32,
+	ISPU_EMU_COST_NORM3_F32,
+	ISPU_EMU_COST_NORMALIZE3_F32,
+	ISPU_EMU_COST_NORMALIZE4_F32,
+	ISPU_EMU_COST_OFFSET_F32,
+	ISPU_EMU_COST_SCALE_F32,
+	ISPU_EMU_COST_SQUARE_F32,
+	ISPU_EMU_COST_SUB_F32,
+	ISPU_EMU_COST_VSQRT_F32,
+	ISPU_EMU_COST_CMPLX_MAG_F32,
+	ISPU_EMU_COST_CMPLX_MAG_SQUARED_F32,
+	ISPU_EMU_COST_BIQUAD_CASCADE_DF1_F32,
+	ISPU_EMU_COST_BIQUAD_CASCADE_DF2T_F32,
+	ISPU_EMU_COST_FIR_F32,
+	ISPU_EMU_COST_FIR_F32_OPT,
+	ISPU_EMU_COST_FIR_DECIMATE_F32,
+	ISPU_EMU_COST_FIR_DECIMATE_F32_OPT,
+	ISPU_EMU_COST_ABSMAX_F32,
+	ISPU_EMU_COST_ABSMAX_NO_IDX_F32,
+	ISPU_EMU_COST_ABSMIN_F32,
+	ISPU_EMU_COST_ABSMIN_NO_IDX_F32,
+	ISPU_EMU_COST_ACCUMULATE_F32,
+	ISPU_EMU_COST_LEVEL_CROSSINGS_F32,
+	ISPU_EMU_COST_MAX_F32,
+	ISPU_EMU_COST_MAX_NO_IDX_F32,
+	ISPU_EMU_COST_MEAN_F32,
+	ISPU_EMU_COST_MEAN_CROSSINGS_F32,
+	ISPU_EMU_COST_MIN_F32,
+	ISPU_EMU_COST_MIN_NO_IDX_F32,
+	ISPU_EMU_COST_PEAK_COUNT_F32,
+	ISPU_EMU_COST_POWER_F32,
+	ISPU_EMU_COST_RMS_F32,
+	ISPU_EMU_COST_STD_F32,
+	ISPU_EMU_COST_VAR_F32,
+	ISPU_EMU_COST_RFFT_F32,
+	ISPU_EMU_COST_IRFFT_F32,
+	ISPU_EMU_COST_HILBERT_F32,
+
+	ISPU_EMU_NUM_COSTS
+};
+
+// cost in cycles of a function: fixed + per_elem * elems + per_inner * inner, the meaning of elems and inner
+// depends on the function (e.g. number of output samples and number of products for a FIR filter)
+struct ispu_emu_cost {
+	const char *name;
+	uint32_t fixed;
+	uint32_t per_elem;
+	uint32_t per_inner;
+};
+
+struct ispu_emu_cost_stats {
+	uint64_t calls;
+	uint64_t cycles;
+};
+
+extern struct ispu_emu_cost ispu_emu_costs[ISPU_EMU_NUM_COSTS];
+extern struct ispu_emu_cost_stats ispu_emu_cost_stats[ISPU_EMU_NUM_COSTS];
+
+// adds the cost of a function to the cycle counter (only while counting is enabled)
+void ispu_emu_charge(enum ispu_emu_cost_id id, uint32_t elems, uint32_t inner);
+
+// cycles charged since the start of the program
+uint64_t ispu_emu_cycles(void);
+
+// enables or disables counting, returns the previous state
+bool ispu_emu_count(bool enable);
+
+// loads the instruction counts of the basic blocks of the program, generated at build time
+int ispu_emu_load_blocks(const char *path);
+
+// overrides the costs of the table with the values of a file (one "name fixed per_elem per_inner" entry per line)
+int ispu_emu_load_costs(const char *path);
+
+// true if the basic block instruction counts were loaded
+bool ispu_emu_blocks_loaded(void);
+
+#endif
+
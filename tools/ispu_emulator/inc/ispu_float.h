@@ -0,0 +1,46 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+// host version of ispu_utils/ispu_float.h: the host floating-point unit and math library are used
+
+#ifndef ISPU_FLOAT_H
+#define ISPU_FLOAT_H
+
+#include <stdint.h>
+#include <math.h>
+#include "reg_map.h"
+
+/**
+  @brief         Signed integer 20 bit to float
+  @param[in]     input          signed integer 20 bit
+  @return                       converted float
+ */
+static inline float sint20_to_float(int32_t input)
+{
+	// same as the device: the integer is added to the mantissa of 2^23 + 2^19, which is then subtracted
+	union {
+		float f_val;
+		uint32_t u_val;
+	} out, offset;
+
+	out.u_val = (uint32_t)input + 0x4b200000u;
+	offset.u_val = 0x4b200000u;
+	// prevents the compiler from turning the sequence back into a conversion instruction
+	__asm__("" : "+r"(out.u_val));
+
+	return out.f_val - offset.f_val;
+}
+
+#endif
+
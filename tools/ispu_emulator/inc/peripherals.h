@@ -0,0 +1,44 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+// host version of ispu_utils/peripherals.h: accesses go through the emulated register file
+
+#ifndef PERIPHERALS_H
+#define PERIPHERALS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "ispu_emu.h"
+
+#define cast_uint64_t(add) (*((volatile uint64_t *)ispu_emu_map((uintptr_t)(add)))) /* to read/write an unsigned 64 bit integer */
+#define cast_uint32_t(add) (*((volatile uint32_t *)ispu_emu_map((uintptr_t)(add)))) /* to read/write an unsigned 32 bit integer */
+#define cast_uint16_t(add) (*((volatile uint16_t *)ispu_emu_map((uintptr_t)(add)))) /* to read/write an unsigned 16 bit integer */
+#define cast_uint8_t(add)  (*((volatile uint8_t *)ispu_emu_map((uintptr_t)(add))))  /* to read/write an unsigned  8 bit integer */
+
+#define cast_sint64_t(add) (*((volatile int64_t *)ispu_emu_map((uintptr_t)(add))))  /* to read/write a signed 64 bit integer */
+#define cast_sint32_t(add) (*((volatile int32_t *)ispu_emu_map((uintptr_t)(add))))  /* to read/write a signed 32 bit integer */
+#define cast_sint16_t(add) (*((volatile int16_t *)ispu_emu_map((uintptr_t)(add))))  /* to read/write a signed 16 bit integer */
+#define cast_sint8_t(add)  (*((volatile int8_t *)ispu_emu_map((uintptr_t)(add))))   /* to read/write a signed  8 bit integer */
+
+#define cast_float(add)    (*((volatile float *)ispu_emu_map((uintptr_t)(add))))    /* to read/write a float 32 bit value */
+
+#define cast_char(add)     (*((volatile char *)ispu_emu_map((uintptr_t)(add))))     /* to read/write a char 8 bit value */
+
+#define nop { }
+#define stop_and_wait_start_pulse do { ispu_emu_wait_start_pulse(); } while (false)
+#define set_sens_sleep { ispu_emu_sens_sleep(); }
+
+#endif
+
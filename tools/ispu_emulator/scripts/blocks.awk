@@ -0,0 +1,87 @@
+# Instruction counts of the basic blocks of the emulated program, from the disassembly of the host executable:
+#
+#   objdump -d --no-show-raw-insn <program> | awk -f blocks.awk > <program>.blocks
+#
+# Every basic block of the program starts with a call to __sanitizer_cov_trace_pc, so the block is identified by the
+# return address of the call and it ends at the first jump or return. One line is printed for each block:
+#
+#   address instructions divsf3 cmpsf2 floatsisf fixsfsi double divsi3 sqrtf
+#
+# where the last columns are the number of host instructions which are implemented by a helper on the ISPU (the
+# instructions column does not include them).
+
+function reset() {
+	start = ""
+	n = 0
+	for (i = 0; i < 7; i++)
+		h[i] = 0
+}
+
+function flush() {
+	if (start != "")
+		print start, n, h[0], h[1], h[2], h[3], h[4], h[5], h[6]
+	reset()
+}
+
+BEGIN {
+	reset()
+	pending = 0
+}
+
+# function label
+/^[0-9a-f]+ <.*>:$/ {
+	flush()
+	pending = 0
+	next
+}
+
+/^ *[0-9a-f]+:\t/ {
+	split($0, fields, "\t")
+	addr = fields[1]
+	sub(/^ */, "", addr)
+	sub(/:$/, "", addr)
+
+	if (pending) {
+		reset()
+		start = addr
+		pending = 0
+	}
+
+	if (fields[2] ~ /<__sanitizer_cov_trace_pc>/) {
+		flush()
+		pending = 1
+		next
+	}
+
+	if (start == "")
+		next
+
+	split(fields[2], words, " ")
+	mnem = words[1]
+	if (mnem == "notrack" || mnem == "bnd" || mnem == "rep" || mnem == "lock")
+		mnem = words[2]
+
+	if (mnem ~ /^v?divss$/)
+		h[0]++
+	else if (mnem ~ /^v?u?comiss$/ || mnem ~ /^v?cmp.*ss$/)
+		h[1]++
+	else if (mnem ~ /^v?cvtsi2ss/)
+		h[2]++
+	else if (mnem ~ /^v?cvtt?ss2si/)
+		h[3]++
+	else if (mnem ~ /sd$/ && mnem !~ /^movs?d$/ || mnem ~ /^v?cvt.*sd/ || mnem ~ /^v?cvtsd/)
+		h[4]++
+	else if (mnem ~ /^i?div[bwlq]?$/)
+		h[5]++
+	else if (mnem ~ /^v?sqrtss$/)
+		h[6]++
+	else
+		n++
+
+	if (mnem ~ /^j/ || mnem ~ /^ret/)
+		flush()
+}
+
+END {
+	flush()
+}
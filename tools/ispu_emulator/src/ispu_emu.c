@@ -0,0 +1,243 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <ucontext.h>
+
+#include "ispu_emu.h"
+#include "ispu_emu_cost.h"
+#include "reg_map.h"
+
+// IIS3DWB10IS: algorithms start from bit 4 of CALL_EN, data valid interrupt enabled by bit 3 of GLB_CALL_EN
+// ISM330IS: algorithms start from bit 1 of CALL_EN, no data valid interrupt
+#ifdef ispu_reg_base
+#define CALL_EN_SHIFT 4u
+#define NUM_ALGOS 16u
+#define GLB_CALL_EN_DATA_VALID 0x08u
+#else
+#define CALL_EN_SHIFT 1u
+#define NUM_ALGOS 30u
+#define GLB_CALL_EN_DATA_VALID 0x00u
+#endif
+
+// the ISPU program runs on its own stack, which must be located in the low 4 GB of the address space
+// so that pointers to local variables can be stored in 32-bit registers as done on the ISPU
+#define PROGRAM_STACK_SIZE (8u * 1024u * 1024u)
+
+#define DECLARE_ALGO(n) \
+	void algo_##n(void) __attribute__ ((weak)); \
+	void algo_##n##_init(void) __attribute__ ((weak));
+
+DECLARE_ALGO(00) DECLARE_ALGO(01) DECLARE_ALGO(02) DECLARE_ALGO(03) DECLARE_ALGO(04)
+DECLARE_ALGO(05) DECLARE_ALGO(06) DECLARE_ALGO(07) DECLARE_ALGO(08) DECLARE_ALGO(09)
+DECLARE_ALGO(10) DECLARE_ALGO(11) DECLARE_ALGO(12) DECLARE_ALGO(13) DECLARE_ALGO(14)
+DECLARE_ALGO(15) DECLARE_ALGO(16) DECLARE_ALGO(17) DECLARE_ALGO(18) DECLARE_ALGO(19)
+DECLARE_ALGO(20) DECLARE_ALGO(21) DECLARE_ALGO(22) DECLARE_ALGO(23) DECLARE_ALGO(24)
+DECLARE_ALGO(25) DECLARE_ALGO(26) DECLARE_ALGO(27) DECLARE_ALGO(28) DECLARE_ALGO(29)
+
+void data_valid_interrupt(void) __attribute__ ((weak));
+
+int ispu_main(void);
+
+#define ALGO_ENTRY(n) { algo_##n##_init, algo_##n }
+
+static const struct {
+	void (*init)(void);
+	void (*run)(void);
+} algos[ISPU_EMU_MAX_ALGOS] = {
+	ALGO_ENTRY(00), ALGO_ENTRY(01), ALGO_ENTRY(02), ALGO_ENTRY(03), ALGO_ENTRY(04),
+	ALGO_ENTRY(05), ALGO_ENTRY(06), ALGO_ENTRY(07), ALGO_ENTRY(08), ALGO_ENTRY(09),
+	ALGO_ENTRY(10), ALGO_ENTRY(11), ALGO_ENTRY(12), ALGO_ENTRY(13), ALGO_ENTRY(14),
+	ALGO_ENTRY(15), ALGO_ENTRY(16), ALGO_ENTRY(17), ALGO_ENTRY(18), ALGO_ENTRY(19),
+	ALGO_ENTRY(20), ALGO_ENTRY(21), ALGO_ENTRY(22), ALGO_ENTRY(23), ALGO_ENTRY(24),
+	ALGO_ENTRY(25), ALGO_ENTRY(26), ALGO_ENTRY(27), ALGO_ENTRY(28), ALGO_ENTRY(29),
+};
+
+__attribute__ ((aligned(8))) uint8_t ispu_emu_regs[ISPU_EMU_REG_SPACE];
+struct ispu_emu_stats ispu_emu_stats;
+
+static __attribute__ ((aligned(16))) uint8_t program_stack[PROGRAM_STACK_SIZE];
+static ucontext_t program_ctx, driver_ctx;
+static bool program_running;
+
+static bool dispatching;
+static bool initialized[ISPU_EMU_MAX_ALGOS];
+
+// INT2 pulses driven by the program through ISPU_INT_PIN: the value is only known at the next register access, so the
+// cycle counter is sampled when the register is mapped and the edge is detected afterwards
+static uint8_t int_pin;
+static uint64_t int_pin_cycles;
+static uint64_t int2_fall_cycles;
+static bool int2_low;
+
+static uint64_t now_ns(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+uint32_t ispu_emu_read(uint32_t addr, uint8_t size)
+{
+	uint32_t val = 0;
+	memcpy(&val, &ispu_emu_regs[addr], size);
+
+	return val;
+}
+
+void ispu_emu_write(uint32_t addr, uint32_t val, uint8_t size)
+{
+	memcpy(&ispu_emu_regs[addr], &val, size);
+}
+
+// runs the algorithms requested through CALL_EN, as the hardware does as soon as the register is written
+static void dispatch(void)
+{
+	uint32_t call_en = ispu_emu_read(ISPU_CALL_EN, 4);
+
+	if (call_en == 0u || dispatching)
+		return;
+
+	dispatching = true;
+
+	for (uint8_t i = 0; i < NUM_ALGOS; i++) {
+		if ((call_en & (1u << (CALL_EN_SHIFT + i))) == 0u)
+			continue;
+
+		// the first call after boot jumps to the initialization vector of the algorithm
+		if (!initialized[i]) {
+			initialized[i] = true;
+			if (algos[i].init != NULL)
+				algos[i].init();
+		} else if (algos[i].run != NULL) {
+			uint64_t start = now_ns();
+			uint64_t start_cycles = ispu_emu_cycles();
+			ispu_emu_count(true);
+			algos[i].run();
+			ispu_emu_count(false);
+			uint64_t cycles = ispu_emu_cycles() - start_cycles;
+			ispu_emu_stats.algo_ns[i] += now_ns() - start;
+			ispu_emu_stats.algo_cycles[i] += cycles;
+			if (cycles > ispu_emu_stats.algo_cycles_max[i])
+				ispu_emu_stats.algo_cycles_max[i] = cycles;
+			ispu_emu_stats.algo_calls[i]++;
+		}
+	}
+
+	ispu_emu_write(ISPU_CALL_EN, 0u, 4);
+
+	dispatching = false;
+}
+
+static void check_int_pin(void)
+{
+	uint8_t val = (uint8_t)ispu_emu_read(ISPU_INT_PIN, 1);
+
+	if (((val ^ int_pin) & 0x02u) != 0u) {
+		if ((val & 0x02u) == 0u) {
+			int2_fall_cycles = int_pin_cycles;
+			int2_low = true;
+		} else if (int2_low) {
+			int2_low = false;
+			ispu_emu_int2_pulse(int_pin_cycles - int2_fall_cycles);
+		}
+	}
+
+	int_pin = val;
+}
+
+volatile void *ispu_emu_map(uintptr_t addr)
+{
+	if (addr >= ISPU_EMU_REG_SPACE)
+		return (volatile void *)addr;
+
+	check_int_pin();
+	if (addr == ISPU_INT_PIN)
+		int_pin_cycles = ispu_emu_cycles();
+
+	dispatch();
+
+	volatile void *port = ispu_emu_accel((uint32_t)addr);
+	if (port != NULL)
+		return port;
+
+	return &ispu_emu_regs[addr];
+}
+
+void ispu_emu_wait_start_pulse(void)
+{
+	swapcontext(&program_ctx, &driver_ctx);
+}
+
+void ispu_emu_sens_sleep(void)
+{
+	ispu_emu_stats.sens_sleep = true;
+}
+
+static void program_entry(void)
+{
+	ispu_main();
+
+	// same as crt0: put the core to sleep forever once main returns
+	program_running = false;
+	ispu_emu_sens_sleep();
+	while (true)
+		ispu_emu_wait_start_pulse();
+}
+
+void ispu_emu_boot(void)
+{
+	getcontext(&program_ctx);
+	program_ctx.uc_stack.ss_sp = program_stack;
+	program_ctx.uc_stack.ss_size = sizeof(program_stack);
+	program_ctx.uc_link = NULL;
+	makecontext(&program_ctx, program_entry, 0);
+
+	// run until the first stop_and_wait_start_pulse
+	program_running = true;
+	swapcontext(&driver_ctx, &program_ctx);
+}
+
+void ispu_emu_data_valid(void)
+{
+	if ((ispu_emu_read(ISPU_GLB_CALL_EN, 1) & GLB_CALL_EN_DATA_VALID) == 0u || data_valid_interrupt == NULL)
+		return;
+
+	uint64_t start_cycles = ispu_emu_cycles();
+	ispu_emu_count(true);
+	data_valid_interrupt();
+	ispu_emu_count(false);
+	ispu_emu_stats.data_valid_cycles += ispu_emu_cycles() - start_cycles;
+	ispu_emu_stats.data_valid_calls++;
+}
+
+void ispu_emu_start_pulse(void)
+{
+	if (!program_running)
+		return;
+
+	ispu_emu_stats.start_pulses++;
+
+	// run one iteration of the main loop, until the next stop_and_wait_start_pulse
+	swapcontext(&driver_ctx, &program_ctx);
+
+	check_int_pin();
+}
+
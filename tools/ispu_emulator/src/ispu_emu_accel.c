@@ -0,0 +1,239 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+// behavioral model of the hardware accelerators (circular buffer, FFT address generators, square root)
+//
+// every access to a match register is redirected to the memory location selected by the accelerator, which is
+// then moved to the next location. The emulator cannot tell loads from stores, but this is not needed as the
+// hardware follows the same sequence of addresses for both. The internal state is kept in the accelerator
+// registers, so that saving and restoring them (as done by the ISPU DSP library) works as on the device.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+
+#include "ispu_emu.h"
+#include "reg_map.h"
+
+#ifdef ISPU_CIRCULAR_MATCH
+
+// the circular buffer must be aligned to 4 KiB, ISPU_CIRCULAR_CURR holds the offset within the aligned block
+#define CIRCULAR_OFFSET_MASK 0xFFFu
+
+// bit 9 of ISPU_FFT_STRIDE_TW selects the twiddle sequence of the split / merge stage of the real FFT
+#define FFT_STRIDE_TW_SPLIT 0x200u
+#define FFT_STRIDE_TW_MASK 0x1FFu
+
+static uint32_t reg(uint32_t addr)
+{
+	return ispu_emu_read(addr, 4);
+}
+
+static void set_reg(uint32_t addr, uint32_t val)
+{
+	ispu_emu_write(addr, val, 4);
+}
+
+static volatile void *host(uint32_t addr)
+{
+	return (volatile void *)(uintptr_t)addr;
+}
+
+static float load_float(uint32_t addr)
+{
+	float val;
+	memcpy(&val, (const void *)(uintptr_t)addr, sizeof(val));
+
+	return val;
+}
+
+// returns a pointer to a register holding the given value, for ports which return computed data
+static volatile void *result(uint32_t addr, float val)
+{
+	memcpy(&ispu_emu_regs[addr], &val, sizeof(val));
+
+	return &ispu_emu_regs[addr];
+}
+
+static volatile void *circular_match(void)
+{
+	uint32_t start = reg(ISPU_CIRCULAR_START);
+	uint32_t end = reg(ISPU_CIRCULAR_END);
+	uint32_t curr = (start & ~CIRCULAR_OFFSET_MASK) | (reg(ISPU_CIRCULAR_CURR) & CIRCULAR_OFFSET_MASK);
+
+	// the pointer moves by one word, plus the number of words specified by the stride, wrapping at the end
+	uint32_t next = curr + 4u * (1u + reg(ISPU_CIRCULAR_STRIDE));
+	if (next >= end)
+		next = start + (next - end);
+	set_reg(ISPU_CIRCULAR_CURR, next & CIRCULAR_OFFSET_MASK);
+
+	return host(curr);
+}
+
+static volatile void *circular_curr(void)
+{
+	// a full address may have been written, only the offset is kept and read back
+	set_reg(ISPU_CIRCULAR_CURR, reg(ISPU_CIRCULAR_CURR) & CIRCULAR_OFFSET_MASK);
+
+	return &ispu_emu_regs[ISPU_CIRCULAR_CURR];
+}
+
+static uint32_t bit_reverse(uint32_t val, uint8_t bits)
+{
+	uint32_t res = 0;
+
+	for (uint8_t i = 0; i < bits; i++) {
+		res = (res << 1) | (val & 1u);
+		val >>= 1;
+	}
+
+	return res;
+}
+
+// bit reverse addressing: each complex number is swapped with the one at the bit reversed index with
+// the sequence x(i), x(RA(i)), x(RA(i)), x(i) for the real part and then for the imaginary part
+static volatile void *fft_match_bra(void)
+{
+	uint8_t bits = 4u + (uint8_t)reg(ISPU_FFT_N_ELEM_BRA); // number of complex numbers is 16 << n_elem_bra
+	uint32_t size = 8u << bits;
+	uint32_t curr = reg(ISPU_FFT_CURR_BRA);
+	uint32_t base = curr & ~(size - 1u); // data is aligned to its size
+	uint32_t phase = reg(ISPU_FFT_STATE_BRA);
+
+	uint32_t i = (curr - base) >> 3;
+	uint32_t ra = bit_reverse(i, bits);
+	if (ra <= i)
+		ra = i; // already swapped
+
+	static const bool use_ra[4] = { false, true, true, false };
+	uint32_t addr = base + ((use_ra[phase & 3u] ? ra : i) << 3) + ((phase & 4u) != 0u ? 4u : 0u);
+
+	if (phase == 7u) {
+		set_reg(ISPU_FFT_CURR_BRA, curr + 8u);
+		phase = 0u;
+	} else {
+		phase++;
+	}
+	set_reg(ISPU_FFT_STATE_BRA, phase);
+
+	return host(addr);
+}
+
+// butterfly data: d1 real, d1 imaginary, d2 real, d2 imaginary, first for loading inputs and then for storing
+// outputs, with d2 at distance ISPU_FFT_TWIDDLE from d1
+static volatile void *fft_match_d(void)
+{
+	uint32_t span = reg(ISPU_FFT_TWIDDLE);
+	uint32_t d1 = reg(ISPU_FFT_CURR_D1);
+	uint32_t phase = reg(ISPU_FFT_STATE_D);
+
+	uint32_t addr = d1 + ((phase & 2u) != 0u ? 8u * span : 0u) + ((phase & 1u) != 0u ? 4u : 0u);
+
+	if (phase == 7u) {
+		// next butterfly of the group, or first butterfly of the next group
+		d1 += 8u;
+		if (((d1 >> 3) & (span - 1u)) == 0u)
+			d1 += 8u * span;
+		set_reg(ISPU_FFT_CURR_D1, d1);
+		phase = 0u;
+	} else {
+		phase++;
+	}
+	set_reg(ISPU_FFT_STATE_D, phase);
+
+	return host(addr);
+}
+
+// twiddle factors: the table holds cos(2 * pi * n / fft_len) for n from 0 to fft_len / 4 (included), the other
+// values are obtained by symmetry
+static volatile void *fft_match_tw(void)
+{
+	uint32_t start = reg(ISPU_FFT_START_TW);
+	uint32_t quarter = (reg(ISPU_FFT_END_TW) - start) >> 2;
+	uint32_t stride = reg(ISPU_FFT_STRIDE_TW);
+	uint32_t tw1 = reg(ISPU_FFT_CURR_TW1);
+	uint32_t tw2 = reg(ISPU_FFT_CURR_TW2);
+	uint32_t phase = reg(ISPU_FFT_STATE_TW);
+	float val;
+
+	if ((stride & FFT_STRIDE_TW_SPLIT) != 0u) {
+		// split / merge stage: cos from the beginning of the table, then sin from the end of the table
+		stride &= FFT_STRIDE_TW_MASK;
+		val = load_float(phase == 0u ? tw1 : tw2);
+		if (phase != 0u) {
+			set_reg(ISPU_FFT_CURR_TW1, tw1 + 4u * stride);
+			set_reg(ISPU_FFT_CURR_TW2, tw2 - 4u * stride);
+		}
+	} else {
+		// butterfly stages: real and imaginary part of exp(-j * 2 * pi * n / fft_len), with n from 0 to fft_len / 2
+		uint32_t n = (tw1 - start) >> 2;
+		if (phase == 0u)
+			val = n <= quarter ? load_float(start + 4u * n) : -load_float(start + 4u * (2u * quarter - n));
+		else
+			val = -(n <= quarter ? load_float(start + 4u * (quarter - n)) : load_float(start + 4u * (n - quarter)));
+
+		if (phase != 0u) {
+			// moving to the next butterfly of the group, back to the first twiddle factor for the next group
+			n += stride;
+			if (n >= 2u * quarter)
+				n = 0u;
+			set_reg(ISPU_FFT_CURR_TW1, start + 4u * n);
+		}
+	}
+	set_reg(ISPU_FFT_STATE_TW, phase ^ 1u);
+
+	return result(ISPU_FFT_MATCH_TW, val);
+}
+
+static volatile void *sqrt_out(void)
+{
+	float in;
+	memcpy(&in, &ispu_emu_regs[ISPU_SQRT_I], sizeof(in));
+
+	return result(ISPU_SQRT_O, sqrtf(in));
+}
+
+volatile void *ispu_emu_accel(uint32_t addr)
+{
+	switch (addr) {
+	case ISPU_CIRCULAR_MATCH:
+		return circular_match();
+	case ISPU_CIRCULAR_CURR:
+		return circular_curr();
+	case ISPU_FFT_MATCH_BRA:
+		return fft_match_bra();
+	case ISPU_FFT_MATCH_D:
+		return fft_match_d();
+	case ISPU_FFT_MATCH_TW:
+		return fft_match_tw();
+	case ISPU_SQRT_O:
+		return sqrt_out();
+	default:
+		return NULL;
+	}
+}
+
+#else
+
+// no hardware accelerators in this device
+volatile void *ispu_emu_accel(uint32_t addr)
+{
+	(void)addr;
+
+	return NULL;
+}
+
+#endif
+
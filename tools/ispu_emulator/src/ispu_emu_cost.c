@@ -0,0 +1,355 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+// cycle estimation: table of costs, basic block accounting and wrappers of the math library
+//
+// the costs of the ISPU DSP library are derived from the instruction counts of the assembly implementation, the
+// costs of the helpers depend on the FAST_* options of the example (same defaults as its Makefile). All the values
+// can be replaced by measurements done on the device through a cost file, without rebuilding the emulator.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ispu_emu_cost.h"
+
+#ifndef FAST_FLOAT
+#define FAST_FLOAT 0
+#endif
+
+#ifndef FAST_SQRTF
+#define FAST_SQRTF 0
+#endif
+
+#ifndef FAST_DIVF
+#define FAST_DIVF 0
+#endif
+
+#ifndef FAST_FLOAT_CMP
+#define FAST_FLOAT_CMP 0
+#endif
+
+// __divsf3 of ispu_float.c (inverse square root with 4 Newton iterations) or of libgcc
+#if FAST_FLOAT || FAST_DIVF
+#define DIVSF3_CYCLES 45u
+#else
+#define DIVSF3_CYCLES 110u
+#endif
+
+// comparison helpers of ispu_float.c (ispu_cmpf32) or of libgcc
+#if FAST_FLOAT || FAST_FLOAT_CMP
+#define CMPSF2_CYCLES 10u
+#else
+#define CMPSF2_CYCLES 30u
+#endif
+
+// sqrtf of ispu_float.h (hardware accelerator) or of the math library
+#if FAST_FLOAT || FAST_SQRTF
+#define SQRTF_CYCLES 6u
+#else
+#define SQRTF_CYCLES 180u
+#endif
+
+// instruction counts of a basic block, the helpers are not included in the number of instructions
+struct block {
+	uint32_t addr;
+	uint16_t instrs;
+	uint8_t helpers[7];
+};
+
+// order of the helper columns in the block file
+static const enum ispu_emu_cost_id block_helpers[7] = {
+	ISPU_EMU_COST_DIVSF3, ISPU_EMU_COST_CMPSF2, ISPU_EMU_COST_FLOATSISF, ISPU_EMU_COST_FIXSFSI,
+	ISPU_EMU_COST_DOUBLE, ISPU_EMU_COST_DIVSI3, ISPU_EMU_COST_SQRTF,
+};
+
+// instructions of a basic block when the block file is not available
+#define DEFAULT_BLOCK_INSTRS 6u
+
+struct ispu_emu_cost ispu_emu_costs[ISPU_EMU_NUM_COSTS] = {
+	[ISPU_EMU_COST_INSTR] = { "instruction", 0, 1, 0 },
+
+	[ISPU_EMU_COST_DIVSF3] = { "__divsf3", DIVSF3_CYCLES, 0, 0 },
+	[ISPU_EMU_COST_CMPSF2] = { "__cmpsf2", CMPSF2_CYCLES, 0, 0 },
+	[ISPU_EMU_COST_FLOATSISF] = { "__floatsisf", 11, 0, 0 },
+	[ISPU_EMU_COST_FIXSFSI] = { "__fixsfsi", 25, 0, 0 },
+	[ISPU_EMU_COST_DOUBLE] = { "double", 80, 0, 0 },
+	[ISPU_EMU_COST_DIVSI3] = { "__divsi3", 40, 0, 0 },
+
+	[ISPU_EMU_COST_SQRTF] = { "sqrtf", SQRTF_CYCLES, 0, 0 },
+	[ISPU_EMU_COST_EXPF] = { "expf", 250, 0, 0 },
+	[ISPU_EMU_COST_LOGF] = { "logf", 250, 0, 0 },
+	[ISPU_EMU_COST_LOG10F] = { "log10f", 270, 0, 0 },
+	[ISPU_EMU_COST_POWF] = { "powf", 600, 0, 0 },
+	[ISPU_EMU_COST_SINF] = { "sinf", 300, 0, 0 },
+	[ISPU_EMU_COST_COSF] = { "cosf", 300, 0, 0 },
+	[ISPU_EMU_COST_TANF] = { "tanf", 350, 0, 0 },
+	[ISPU_EMU_COST_ASINF] = { "asinf", 300, 0, 0 },
+	[ISPU_EMU_COST_ACOSF] = { "acosf", 300, 0, 0 },
+	[ISPU_EMU_COST_ATANF] = { "atanf", 250, 0, 0 },
+	[ISPU_EMU_COST_ATAN2F] = { "atan2f", 300, 0, 0 },
+	[ISPU_EMU_COST_TANHF] = { "tanhf", 300, 0, 0 },
+	[ISPU_EMU_COST_EXP] = { "exp", 1500, 0, 0 },
+	[ISPU_EMU_COST_LOG] = { "log", 1500, 0, 0 },
+	[ISPU_EMU_COST_POW] = { "pow", 3000, 0, 0 },
+	[ISPU_EMU_COST_SIN] = { "sin", 1500, 0, 0 },
+	[ISPU_EMU_COST_COS] = { "cos", 1500, 0, 0 },
+	[ISPU_EMU_COST_ATAN2] = { "atan2", 1800, 0, 0 },
+
+	// elems: number of elements (vectors for norm3 and normalize, complex numbers for cmplx_mag)
+	[ISPU_EMU_COST_ABS_F32] = { "ispu_abs_f32", 8, 3, 0 },
+	[ISPU_EMU_COST_ADD_F32] = { "ispu_add_f32", 8, 4, 0 },
+	[ISPU_EMU_COST_CLIP_F32] = { "ispu_clip_f32", 10, 4, 0 },
+	[ISPU_EMU_COST_INV_NORM3_F32] = { "ispu_inv_norm3_f32", 12, 17, 0 }, // norm3 charged separately
+	[ISPU_EMU_COST_MULT_F32] = { "ispu_mult_f32", 8, 4, 0 },
+	[ISPU_EMU_COST_NEGATE_F32] = { "ispu_negate_f32", 8, 3, 0 },
+	[ISPU_EMU_COST_NORM3_F32] = { "ispu_norm3_f32", 12, 10, 0 },
+	[ISPU_EMU_COST_NORMALIZE3_F32] = { "ispu_normalize3_f32", 10, 37, 0 },
+	[ISPU_EMU_COST_NORMALIZE4_F32] = { "ispu_normalize4_f32", 10, 45, 0 },
+	[ISPU_EMU_COST_OFFSET_F32] = { "ispu_offset_f32", 8, 3, 0 },
+	[ISPU_EMU_COST_SCALE_F32] = { "ispu_scale_f32", 8, 3, 0 },
+	[ISPU_EMU_COST_SQUARE_F32] = { "ispu_square_f32", 8, 3, 0 },
+	[ISPU_EMU_COST_SUB_F32] = { "ispu_sub_f32", 8, 4, 0 },
+	[ISPU_EMU_COST_VSQRT_F32] = { "ispu_vsqrt_f32", 16, 4, 0 },
+	[ISPU_EMU_COST_CMPLX_MAG_F32] = { "ispu_cmplx_mag_f32", 20, 7, 0 },
+	[ISPU_EMU_COST_CMPLX_MAG_SQUARED_F32] = { "ispu_cmplx_mag_squared_f32", 8, 6, 0 },
+
+	// elems: samples times stages, inner: stages
+	[ISPU_EMU_COST_BIQUAD_CASCADE_DF1_F32] = { "ispu_biquad_cascade_df1_f32", 40, 13, 30 },
+	[ISPU_EMU_COST_BIQUAD_CASCADE_DF2T_F32] = { "ispu_biquad_cascade_df2T_f32", 35, 12, 25 },
+
+	// elems: output samples, inner: products plus input samples
+	[ISPU_EMU_COST_FIR_F32] = { "ispu_fir_f32", 30, 10, 3 },
+	[ISPU_EMU_COST_FIR_F32_OPT] = { "ispu_fir_f32_opt", 40, 13, 3 },
+	[ISPU_EMU_COST_FIR_DECIMATE_F32] = { "ispu_fir_decimate_f32", 40, 16, 3 },
+	[ISPU_EMU_COST_FIR_DECIMATE_F32_OPT] = { "ispu_fir_decimate_f32_opt", 45, 16, 3 },
+
+	// elems: number of samples, the functions and helpers called by mean, var, std, rms and mean_crossings are
+	// charged separately
+	[ISPU_EMU_COST_ABSMAX_F32] = { "ispu_absmax_f32", 14, 6, 0 },
+	[ISPU_EMU_COST_ABSMAX_NO_IDX_F32] = { "ispu_absmax_no_idx_f32", 8, 3, 0 },
+	[ISPU_EMU_COST_ABSMIN_F32] = { "ispu_absmin_f32", 14, 6, 0 },
+	[ISPU_EMU_COST_ABSMIN_NO_IDX_F32] = { "ispu_absmin_no_idx_f32", 8, 3, 0 },
+	[ISPU_EMU_COST_ACCUMULATE_F32] = { "ispu_accumulate_f32", 8, 2, 0 },
+	[ISPU_EMU_COST_LEVEL_CROSSINGS_F32] = { "ispu_level_crossings_f32", 16, 8, 0 },
+	[ISPU_EMU_COST_MAX_F32] = { "ispu_max_f32", 14, 5, 0 },
+	[ISPU_EMU_COST_MAX_NO_IDX_F32] = { "ispu_max_no_idx_f32", 8, 2, 0 },
+	[ISPU_EMU_COST_MEAN_F32] = { "ispu_mean_f32", 14, 0, 0 },
+	[ISPU_EMU_COST_MEAN_CROSSINGS_F32] = { "ispu_mean_crossings_f32", 20, 2, 0 },
+	[ISPU_EMU_COST_MIN_F32] = { "ispu_min_f32", 14, 5, 0 },
+	[ISPU_EMU_COST_MIN_NO_IDX_F32] = { "ispu_min_no_idx_f32", 8, 2, 0 },
+	[ISPU_EMU_COST_PEAK_COUNT_F32] = { "ispu_peak_count_f32", 16, 17, 0 },
+	[ISPU_EMU_COST_POWER_F32] = { "ispu_power_f32", 10, 2, 0 },
+	[ISPU_EMU_COST_RMS_F32] = { "ispu_rms_f32", 20, 0, 0 },
+	[ISPU_EMU_COST_STD_F32] = { "ispu_std_f32", 8, 0, 0 },
+	[ISPU_EMU_COST_VAR_F32] = { "ispu_var_f32", 16, 3, 0 },
+
+	// elems: complex numbers, inner: butterflies of the stages after the second one
+	[ISPU_EMU_COST_RFFT_F32] = { "ispu_rfft_f32", 150, 31, 24 },
+	[ISPU_EMU_COST_IRFFT_F32] = { "ispu_irfft_f32", 160, 31, 25 },
+	// elems: samples, the FFTs are charged separately
+	[ISPU_EMU_COST_HILBERT_F32] = { "ispu_hilbert_f32", 60, 8, 0 },
+};
+
+struct ispu_emu_cost_stats ispu_emu_cost_stats[ISPU_EMU_NUM_COSTS];
+
+static uint64_t cycles;
+static bool counting;
+
+static struct block *blocks;
+static size_t num_blocks;
+
+void ispu_emu_charge(enum ispu_emu_cost_id id, uint32_t elems, uint32_t inner)
+{
+	if (!counting)
+		return;
+
+	const struct ispu_emu_cost *cost = &ispu_emu_costs[id];
+	uint64_t c = cost->fixed + (uint64_t)cost->per_elem * elems + (uint64_t)cost->per_inner * inner;
+
+	ispu_emu_cost_stats[id].calls++;
+	ispu_emu_cost_stats[id].cycles += c;
+	cycles += c;
+}
+
+uint64_t ispu_emu_cycles(void)
+{
+	return cycles;
+}
+
+bool ispu_emu_count(bool enable)
+{
+	bool prev = counting;
+	counting = enable;
+
+	return prev;
+}
+
+bool ispu_emu_blocks_loaded(void)
+{
+	return num_blocks > 0u;
+}
+
+static int compare_blocks(const void *a, const void *b)
+{
+	uint32_t addr_a = ((const struct block *)a)->addr;
+	uint32_t addr_b = ((const struct block *)b)->addr;
+
+	return addr_a < addr_b ? -1 : (addr_a > addr_b ? 1 : 0);
+}
+
+int ispu_emu_load_blocks(const char *path)
+{
+	FILE *f = fopen(path, "r");
+	if (f == NULL)
+		return -1;
+
+	size_t size = 0;
+	char line[256];
+	while (fgets(line, sizeof(line), f) != NULL) {
+		struct block b;
+		unsigned int v[8];
+
+		if (sscanf(line, "%x %u %u %u %u %u %u %u %u", &b.addr, &v[0], &v[1], &v[2], &v[3], &v[4], &v[5], &v[6],
+		           &v[7]) != 9)
+			continue;
+
+		b.instrs = (uint16_t)v[0];
+		for (uint8_t i = 0; i < 7u; i++)
+			b.helpers[i] = (uint8_t)v[i + 1u];
+
+		if (num_blocks == size) {
+			size = size == 0u ? 1024u : 2u * size;
+			struct block *tmp = realloc(blocks, size * sizeof(*blocks));
+			if (tmp == NULL) {
+				fclose(f);
+				return -1;
+			}
+			blocks = tmp;
+		}
+		blocks[num_blocks++] = b;
+	}
+
+	fclose(f);
+
+	qsort(blocks, num_blocks, sizeof(*blocks), compare_blocks);
+
+	return 0;
+}
+
+int ispu_emu_load_costs(const char *path)
+{
+	FILE *f = fopen(path, "r");
+	if (f == NULL)
+		return -1;
+
+	char line[256];
+	while (fgets(line, sizeof(line), f) != NULL) {
+		char name[64];
+		unsigned int fixed, per_elem = 0, per_inner = 0;
+
+		if (line[0] == '#' || sscanf(line, "%63s %u %u %u", name, &fixed, &per_elem, &per_inner) < 2)
+			continue;
+
+		bool found = false;
+		for (uint32_t i = 0; i < ISPU_EMU_NUM_COSTS; i++) {
+			if (strcmp(name, ispu_emu_costs[i].name) == 0) {
+				ispu_emu_costs[i].fixed = fixed;
+				ispu_emu_costs[i].per_elem = per_elem;
+				ispu_emu_costs[i].per_inner = per_inner;
+				found = true;
+			}
+		}
+
+		if (!found)
+			fprintf(stderr, "Unknown function %s in cost file\n", name);
+	}
+
+	fclose(f);
+
+	return 0;
+}
+
+static void charge_block(const struct block *b)
+{
+	ispu_emu_charge(ISPU_EMU_COST_INSTR, b->instrs, 0);
+
+	for (uint8_t i = 0; i < 7u; i++) {
+		for (uint8_t j = 0; j < b->helpers[i]; j++)
+			ispu_emu_charge(block_helpers[i], 0, 0);
+	}
+}
+
+// called at the beginning of every basic block of the program (compiled with -fsanitize-coverage=trace-pc), the
+// return address identifies the block
+void __sanitizer_cov_trace_pc(void)
+{
+	if (!counting)
+		return;
+
+	struct block key = { .addr = (uint32_t)(uintptr_t)__builtin_return_address(0) };
+	const struct block *b = NULL;
+	if (num_blocks > 0u)
+		b = bsearch(&key, blocks, num_blocks, sizeof(*blocks), compare_blocks);
+
+	if (b != NULL) {
+		charge_block(b);
+	} else if (num_blocks > 0u) {
+		// last block of a function ending with a tail call to this function, the return address is in the caller
+		ispu_emu_charge(ISPU_EMU_COST_INSTR, 1u, 0);
+	} else {
+		ispu_emu_charge(ISPU_EMU_COST_INSTR, DEFAULT_BLOCK_INSTRS, 0);
+	}
+}
+
+// the functions of the math library called by the program are wrapped by the linker (--wrap)
+#define WRAP_1(type, name, id) \
+	type __real_##name(type x); \
+	type __wrap_##name(type x); \
+	type __wrap_##name(type x) \
+	{ \
+		ispu_emu_charge(id, 0, 0); \
+		return __real_##name(x); \
+	}
+
+#define WRAP_2(type, name, id) \
+	type __real_##name(type x, type y); \
+	type __wrap_##name(type x, type y); \
+	type __wrap_##name(type x, type y) \
+	{ \
+		ispu_emu_charge(id, 0, 0); \
+		return __real_##name(x, y); \
+	}
+
+WRAP_1(float, expf, ISPU_EMU_COST_EXPF)
+WRAP_1(float, logf, ISPU_EMU_COST_LOGF)
+WRAP_1(float, log10f, ISPU_EMU_COST_LOG10F)
+WRAP_2(float, powf, ISPU_EMU_COST_POWF)
+WRAP_1(float, sinf, ISPU_EMU_COST_SINF)
+WRAP_1(float, cosf, ISPU_EMU_COST_COSF)
+WRAP_1(float, tanf, ISPU_EMU_COST_TANF)
+WRAP_1(float, asinf, ISPU_EMU_COST_ASINF)
+WRAP_1(float, acosf, ISPU_EMU_COST_ACOSF)
+WRAP_1(float, atanf, ISPU_EMU_COST_ATANF)
+WRAP_2(float, atan2f, ISPU_EMU_COST_ATAN2F)
+WRAP_1(float, tanhf, ISPU_EMU_COST_TANHF)
+WRAP_1(double, exp, ISPU_EMU_COST_EXP)
+WRAP_1(double, log, ISPU_EMU_COST_LOG)
+WRAP_2(double, pow, ISPU_EMU_COST_POW)
+WRAP_1(double, sin, ISPU_EMU_COST_SIN)
+WRAP_1(double, cos, ISPU_EMU_COST_COS)
+WRAP_2(double, atan2, ISPU_EMU_COST_ATAN2)
+
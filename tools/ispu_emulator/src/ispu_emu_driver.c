@@ -0,0 +1,673 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <time.h>
+#include <getopt.h>
+
+#include "ispu_emu.h"
+#include "ispu_emu_cost.h"
+#include "reg_map.h"
+
+#ifndef ISPU_EMU_CONF
+#define ISPU_EMU_CONF "conf.txt"
+#endif
+
+#ifndef ISPU_EMU_META
+#define ISPU_EMU_META "meta.txt"
+#endif
+
+// IIS3DWB10IS: fixed 40 MHz ISPU clock
+// ISM330IS: 5 or 10 MHz, selected by ispu_clock in the configuration file
+#ifdef ispu_reg_base
+#define DEFAULT_CLOCK_MHZ 40.0f
+#else
+#define DEFAULT_CLOCK_MHZ 5.0f
+#endif
+
+// number of functions listed in the cycle estimation report
+#define MAX_REPORTED_COSTS 10u
+
+#define LINE_LEN 1024u
+#define MAX_COLUMNS 32u
+#define MAX_OUTPUTS 64u
+
+struct input_reg {
+	const char *name;
+	uint32_t addr;
+};
+
+// sensor registers that can be fed from the input CSV file (the column names are the register names)
+static const struct input_reg input_regs[] = {
+	{ "ARAW_X", ISPU_ARAW_X }, { "ARAW_Y", ISPU_ARAW_Y }, { "ARAW_Z", ISPU_ARAW_Z },
+#ifdef ISPU_GRAW_X
+	{ "GRAW_X", ISPU_GRAW_X }, { "GRAW_Y", ISPU_GRAW_Y }, { "GRAW_Z", ISPU_GRAW_Z },
+#endif
+#ifdef ISPU_ERAW_0
+	{ "ERAW_0", ISPU_ERAW_0 }, { "ERAW_1", ISPU_ERAW_1 }, { "ERAW_2", ISPU_ERAW_2 },
+#endif
+	{ "TEMP", ISPU_TEMP },
+};
+
+enum output_type {
+	TYPE_UINT8,
+	TYPE_INT8,
+	TYPE_UINT16,
+	TYPE_INT16,
+	TYPE_UINT32,
+	TYPE_INT32,
+	TYPE_FLOAT,
+	TYPE_CHAR,
+};
+
+struct output {
+	char name[128];
+	enum output_type type;
+	uint16_t count;
+};
+
+struct conf {
+	uint32_t algo;
+	uint32_t int1_ctrl;
+	uint32_t int2_ctrl;
+	float rate;
+	float clock_mhz;
+};
+
+struct slot_stats {
+	uint64_t cycles_max; // estimated ISPU cycles of the longest time slot
+	uint64_t overruns; // number of time slots exceeding the sample period
+	uint64_t cycles; // estimated ISPU cycles of all the time slots
+};
+
+static const struct {
+	const char *name;
+	enum output_type type;
+	uint8_t size;
+} types[] = {
+	{ "uint8_t", TYPE_UINT8, 1 }, { "int8_t", TYPE_INT8, 1 },
+	{ "uint16_t", TYPE_UINT16, 2 }, { "int16_t", TYPE_INT16, 2 },
+	{ "uint32_t", TYPE_UINT32, 4 }, { "int32_t", TYPE_INT32, 4 },
+	{ "float", TYPE_FLOAT, 4 }, { "char", TYPE_CHAR, 1 },
+};
+
+static struct output outputs[MAX_OUTPUTS];
+static uint8_t num_outputs;
+
+// INT2 pulse log, in the same time unit as the execution time printed by the test header firmware
+static FILE *pulse_file;
+static uint64_t current_sample;
+static float pulse_clock_mhz;
+
+static void usage(const char *prog)
+{
+	fprintf(stderr, "Usage: %s [options]\n", prog);
+	fprintf(stderr, "  -i <file>  input CSV file with one row per time slot (default: stdin)\n");
+	fprintf(stderr, "             the header contains the names of the sensor registers (e.g. ARAW_X,ARAW_Y,ARAW_Z)\n");
+	fprintf(stderr, "  -o <file>  output CSV file (default: stdout)\n");
+	fprintf(stderr, "  -c <file>  configuration file (default: %s)\n", ISPU_EMU_CONF);
+	fprintf(stderr, "  -m <file>  output description file (default: %s)\n", ISPU_EMU_META);
+	fprintf(stderr, "  -a         log the outputs at every time slot instead of only when INT1 is asserted\n");
+	fprintf(stderr, "  -s         print execution statistics and estimated ISPU cycles to stderr\n");
+	fprintf(stderr, "  -f <MHz>   ISPU clock used to check the cycle budget (default: from the configuration file)\n");
+	fprintf(stderr, "  -t <file>  cost file overriding the cycles of the functions (one \"name fixed per_elem per_inner\"\n");
+	fprintf(stderr, "             line per function, e.g. measured on the device)\n");
+	fprintf(stderr, "  -b <file>  basic block file generated at build time (default: <program>.blocks)\n");
+	fprintf(stderr, "  -p <file>  CSV file logging the estimated duration of each low pulse driven by the program on INT2\n");
+}
+
+static uint8_t type_size(enum output_type type)
+{
+	for (uint8_t i = 0; i < sizeof(types) / sizeof(types[0]); i++) {
+		if (types[i].type == type)
+			return types[i].size;
+	}
+
+	return 0;
+}
+
+static float parse_rate(const char *str)
+{
+	char *end;
+	float rate = strtof(str, &end);
+
+	if (*end == 'k' || *end == 'K')
+		rate *= 1000.0f;
+
+	return rate;
+}
+
+static int parse_conf(const char *path, struct conf *conf)
+{
+	FILE *f = fopen(path, "r");
+	if (f == NULL) {
+		fprintf(stderr, "Cannot open configuration file %s\n", path);
+		return -1;
+	}
+
+	char line[LINE_LEN];
+	while (fgets(line, sizeof(line), f) != NULL) {
+		char key[64], val[64], en[64];
+		int n = sscanf(line, "%63s %63s %63s", key, val, en);
+
+		if (n == 2 && (strcmp(key, "ispu_rate") == 0 || strcmp(key, "ispu_irq_rate") == 0)) {
+			conf->rate = parse_rate(val);
+		} else if (n == 2 && strcmp(key, "ispu_clock") == 0) {
+			conf->clock_mhz = strtof(val, NULL);
+		} else if (n == 3 && strcmp(en, "enable") == 0) {
+			uint32_t bit = 1u << (uint32_t)atoi(val);
+
+			if (strcmp(key, "algo") == 0)
+				conf->algo |= bit;
+			else if (strcmp(key, "ispu_flag_int1") == 0 || strcmp(key, "algo_int1") == 0)
+				conf->int1_ctrl |= bit;
+			else if (strcmp(key, "ispu_flag_int2") == 0 || strcmp(key, "algo_int2") == 0)
+				conf->int2_ctrl |= bit;
+		}
+	}
+
+	fclose(f);
+
+	return 0;
+}
+
+static int parse_meta(const char *path)
+{
+	FILE *f = fopen(path, "r");
+	if (f == NULL) {
+		fprintf(stderr, "Cannot open output description file %s\n", path);
+		return -1;
+	}
+
+	char line[LINE_LEN];
+	while (fgets(line, sizeof(line), f) != NULL) {
+		if (strncmp(line, "output", 6) != 0)
+			continue;
+
+		char *name = strchr(line, '"');
+		char *name_end = name != NULL ? strchr(name + 1, '"') : NULL;
+		if (name_end == NULL || num_outputs == MAX_OUTPUTS)
+			continue;
+
+		char type[32];
+		unsigned int count = 1;
+		if (sscanf(name_end + 1, "%31s %u", type, &count) < 1)
+			continue;
+
+		struct output *out = &outputs[num_outputs];
+		*name_end = '\0';
+		snprintf(out->name, sizeof(out->name), "%s", name + 1);
+		out->count = (uint16_t)count;
+
+		bool found = false;
+		for (uint8_t i = 0; i < sizeof(types) / sizeof(types[0]); i++) {
+			if (strcmp(type, types[i].name) == 0) {
+				out->type = types[i].type;
+				found = true;
+			}
+		}
+
+		if (!found) {
+			fprintf(stderr, "Unsupported output type %s\n", type);
+			fclose(f);
+			return -1;
+		}
+
+		num_outputs++;
+	}
+
+	fclose(f);
+
+	return 0;
+}
+
+static void write_name(FILE *f, const char *name, int idx)
+{
+	if (idx < 0)
+		fprintf(f, ",\"%s\"", name);
+	else
+		fprintf(f, ",\"%s[%d]\"", name, idx);
+}
+
+static void write_header(FILE *f)
+{
+	fprintf(f, "\"Sample\"");
+
+	for (uint8_t i = 0; i < num_outputs; i++) {
+		if (outputs[i].type == TYPE_CHAR || outputs[i].count == 1u) {
+			write_name(f, outputs[i].name, -1);
+		} else {
+			for (uint16_t j = 0; j < outputs[i].count; j++)
+				write_name(f, outputs[i].name, j);
+		}
+	}
+
+	fprintf(f, "\n");
+}
+
+static void write_outputs(FILE *f, uint64_t sample)
+{
+	uint32_t addr = ISPU_DOUT_00;
+
+	fprintf(f, "%llu", (unsigned long long)sample);
+
+	for (uint8_t i = 0; i < num_outputs; i++) {
+		const struct output *out = &outputs[i];
+		uint8_t size = type_size(out->type);
+
+		if (out->type == TYPE_CHAR) {
+			char str[256];
+			uint16_t len = out->count < sizeof(str) ? out->count : sizeof(str) - 1u;
+			memcpy(str, &ispu_emu_regs[addr], len);
+			str[len] = '\0';
+			fprintf(f, ",\"%s\"", str);
+			addr += out->count;
+			continue;
+		}
+
+		for (uint16_t j = 0; j < out->count; j++) {
+			uint32_t raw = ispu_emu_read(addr, size);
+			float fval;
+
+			switch (out->type) {
+			case TYPE_UINT8:
+			case TYPE_UINT16:
+			case TYPE_UINT32:
+				fprintf(f, ",%lu", (unsigned long)raw);
+				break;
+			case TYPE_INT8:
+				fprintf(f, ",%d", (int8_t)raw);
+				break;
+			case TYPE_INT16:
+				fprintf(f, ",%d", (int16_t)raw);
+				break;
+			case TYPE_INT32:
+				fprintf(f, ",%ld", (long)(int32_t)raw);
+				break;
+			case TYPE_FLOAT:
+				memcpy(&fval, &raw, sizeof(fval));
+				fprintf(f, ",%.9g", (double)fval);
+				break;
+			default:
+				break;
+			}
+
+			addr += size;
+		}
+	}
+
+	fprintf(f, "\n");
+}
+
+void ispu_emu_int2_pulse(uint64_t cycles)
+{
+	if (pulse_file == NULL)
+		return;
+
+	fprintf(pulse_file, "%llu,%llu,%.3f\n", (unsigned long long)current_sample, (unsigned long long)cycles,
+	        (double)cycles / (double)pulse_clock_mhz);
+}
+
+static int parse_header(char *line, const struct input_reg **columns, uint8_t *num_columns)
+{
+	*num_columns = 0;
+
+	for (char *tok = strtok(line, ",\r\n"); tok != NULL; tok = strtok(NULL, ",\r\n")) {
+		while (isspace((unsigned char)*tok) || *tok == '"')
+			tok++;
+		size_t len = strlen(tok);
+		while (len > 0u && (isspace((unsigned char)tok[len - 1u]) || tok[len - 1u] == '"'))
+			tok[--len] = '\0';
+
+		// the ISPU_ prefix is optional
+		if (strncmp(tok, "ISPU_", 5) == 0)
+			tok += 5;
+
+		const struct input_reg *reg = NULL;
+		for (uint8_t i = 0; i < sizeof(input_regs) / sizeof(input_regs[0]); i++) {
+			if (strcmp(tok, input_regs[i].name) == 0)
+				reg = &input_regs[i];
+		}
+
+		if (reg == NULL) {
+			fprintf(stderr, "Unknown input register %s\n", tok);
+			return -1;
+		}
+
+		if (*num_columns == MAX_COLUMNS)
+			return -1;
+
+		columns[(*num_columns)++] = reg;
+	}
+
+	return *num_columns > 0u ? 0 : -1;
+}
+
+// converts the comma-separated values of a row, returns the number of values (0 for an empty row) or -1 if a field is
+// not a number
+static int parse_row(char *line, uint32_t *values, uint8_t max_values)
+{
+	line[strcspn(line, "\r\n")] = '\0';
+
+	char *p = line;
+	while (isspace((unsigned char)*p))
+		p++;
+	if (*p == '\0')
+		return 0;
+
+	int n = 0;
+	for (char *tok = line; tok != NULL; n++) {
+		char *sep = strchr(tok, ',');
+		if (sep != NULL)
+			*sep++ = '\0';
+
+		char *end;
+		long val = strtol(tok, &end, 0);
+		while (isspace((unsigned char)*end))
+			end++;
+		if (end == tok || *end != '\0')
+			return -1;
+
+		if (n < max_values)
+			values[n] = (uint32_t)val;
+		tok = sep;
+	}
+
+	return n;
+}
+
+static void print_costs(void)
+{
+	bool reported[ISPU_EMU_NUM_COSTS] = { false };
+
+	fprintf(stderr, "Most expensive functions:\n");
+
+	for (uint8_t n = 0; n < MAX_REPORTED_COSTS; n++) {
+		int32_t max = -1;
+		for (uint32_t i = 0; i < ISPU_EMU_NUM_COSTS; i++) {
+			if (!reported[i] && ispu_emu_cost_stats[i].cycles > 0u &&
+			    (max < 0 || ispu_emu_cost_stats[i].cycles > ispu_emu_cost_stats[max].cycles))
+				max = (int32_t)i;
+		}
+
+		if (max < 0)
+			break;
+
+		reported[max] = true;
+		const struct ispu_emu_cost_stats *stats = &ispu_emu_cost_stats[max];
+		if (max == ISPU_EMU_COST_INSTR) {
+			fprintf(stderr, "  %-28s %llu cycles, %llu basic blocks\n", "(program)", (unsigned long long)stats->cycles,
+			        (unsigned long long)stats->calls);
+		} else {
+			fprintf(stderr, "  %-28s %llu cycles, %llu calls\n", ispu_emu_costs[max].name,
+			        (unsigned long long)stats->cycles, (unsigned long long)stats->calls);
+		}
+	}
+}
+
+static void print_cycles(const struct conf *conf, const struct slot_stats *slots)
+{
+	float budget = conf->rate > 0.0f ? conf->clock_mhz * 1e6f / conf->rate : 0.0f;
+
+	fprintf(stderr, "Estimated ISPU cycles at %g MHz", (double)conf->clock_mhz);
+	if (budget > 0.0f)
+		fprintf(stderr, " (budget %.0f cycles per time slot)", (double)budget);
+	fprintf(stderr, ":\n");
+
+	if (!ispu_emu_blocks_loaded())
+		fprintf(stderr, "  basic block file not found, the cycles of the program are a rough approximation\n");
+
+	for (uint8_t i = 0; i < ISPU_EMU_MAX_ALGOS; i++) {
+		uint64_t calls = ispu_emu_stats.algo_calls[i];
+		if (calls == 0u)
+			continue;
+
+		double mean = (double)ispu_emu_stats.algo_cycles[i] / (double)calls;
+		fprintf(stderr, "  algo_%02u: %.0f cycles per call, %llu max", i, mean,
+		        (unsigned long long)ispu_emu_stats.algo_cycles_max[i]);
+		if (budget > 0.0f)
+			fprintf(stderr, " (%.1f%% of the budget)", 100.0 * (double)ispu_emu_stats.algo_cycles_max[i] / (double)budget);
+		fprintf(stderr, "\n");
+	}
+
+	if (ispu_emu_stats.data_valid_calls > 0u) {
+		fprintf(stderr, "  data_valid_interrupt: %.0f cycles per call\n",
+		        (double)ispu_emu_stats.data_valid_cycles / (double)ispu_emu_stats.data_valid_calls);
+	}
+
+	fprintf(stderr, "  time slot: %llu cycles max", (unsigned long long)slots->cycles_max);
+	if (budget > 0.0f && ispu_emu_stats.start_pulses > 0u) {
+		fprintf(stderr, ", %llu time slots over budget, average load %.1f%%", (unsigned long long)slots->overruns,
+		        100.0 * (double)slots->cycles / ((double)budget * (double)ispu_emu_stats.start_pulses));
+	}
+	fprintf(stderr, "\n");
+
+	print_costs();
+}
+
+static void print_stats(const struct conf *conf, const struct slot_stats *slots, double elapsed)
+{
+	uint64_t num_slots = ispu_emu_stats.start_pulses;
+
+	fprintf(stderr, "Time slots: %llu\n", (unsigned long long)num_slots);
+	fprintf(stderr, "Host time: %.3f s", elapsed);
+	if (conf->rate > 0.0f && elapsed > 0.0)
+		fprintf(stderr, " (%.1fx real time at %g Hz)", (double)num_slots / (double)conf->rate / elapsed, (double)conf->rate);
+	fprintf(stderr, "\n");
+
+	for (uint8_t i = 0; i < ISPU_EMU_MAX_ALGOS; i++) {
+		uint64_t calls = ispu_emu_stats.algo_calls[i];
+		if (calls == 0u)
+			continue;
+
+		fprintf(stderr, "algo_%02u: %llu calls, %.3f us per call on host\n", i, (unsigned long long)calls,
+		        (double)ispu_emu_stats.algo_ns[i] / (double)calls / 1000.0);
+	}
+
+	print_cycles(conf, slots);
+}
+
+int main(int argc, char **argv)
+{
+	const char *in_path = NULL, *out_path = NULL;
+	const char *conf_path = ISPU_EMU_CONF, *meta_path = ISPU_EMU_META;
+	const char *cost_path = NULL, *blocks_path = NULL, *pulse_path = NULL;
+	bool log_all = false, stats = false;
+	float clock_mhz = 0.0f;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "i:o:c:m:asf:t:b:p:h")) != -1) {
+		switch (opt) {
+		case 'i':
+			in_path = optarg;
+			break;
+		case 'o':
+			out_path = optarg;
+			break;
+		case 'c':
+			conf_path = optarg;
+			break;
+		case 'm':
+			meta_path = optarg;
+			break;
+		case 'a':
+			log_all = true;
+			break;
+		case 's':
+			stats = true;
+			break;
+		case 'f':
+			clock_mhz = strtof(optarg, NULL);
+			break;
+		case 't':
+			cost_path = optarg;
+			break;
+		case 'b':
+			blocks_path = optarg;
+			break;
+		case 'p':
+			pulse_path = optarg;
+			break;
+		default:
+			usage(argv[0]);
+			return opt == 'h' ? 0 : 1;
+		}
+	}
+
+	struct conf conf = { .clock_mhz = DEFAULT_CLOCK_MHZ };
+	if (parse_conf(conf_path, &conf) != 0 || parse_meta(meta_path) != 0)
+		return 1;
+
+	if (clock_mhz > 0.0f)
+		conf.clock_mhz = clock_mhz;
+
+	if (cost_path != NULL && ispu_emu_load_costs(cost_path) != 0) {
+		fprintf(stderr, "Cannot open cost file %s\n", cost_path);
+		return 1;
+	}
+
+	// the block file is generated next to the program at build time
+	char default_blocks[LINE_LEN];
+	if (blocks_path == NULL) {
+		snprintf(default_blocks, sizeof(default_blocks), "%s.blocks", argv[0]);
+		blocks_path = default_blocks;
+	}
+	ispu_emu_load_blocks(blocks_path);
+
+	FILE *in = in_path != NULL ? fopen(in_path, "r") : stdin;
+	FILE *out = out_path != NULL ? fopen(out_path, "w") : stdout;
+	if (in == NULL || out == NULL) {
+		fprintf(stderr, "Cannot open input or output file\n");
+		return 1;
+	}
+
+	if (pulse_path != NULL) {
+		pulse_file = fopen(pulse_path, "w");
+		if (pulse_file == NULL) {
+			fprintf(stderr, "Cannot open pulse file %s\n", pulse_path);
+			return 1;
+		}
+		fprintf(pulse_file, "\"Sample\",\"Cycles\",\"Time [us]\"\n");
+		pulse_clock_mhz = conf.clock_mhz;
+	}
+
+	char line[LINE_LEN];
+	const struct input_reg *columns[MAX_COLUMNS];
+	uint8_t num_columns;
+	if (fgets(line, sizeof(line), in) == NULL || parse_header(line, columns, &num_columns) != 0) {
+		fprintf(stderr, "Invalid input header\n");
+		return 1;
+	}
+
+	// registers written by the device according to the configuration
+	ispu_emu_write(ISPU_ALGO, conf.algo, 4);
+	ispu_emu_write(ISPU_INT1_CTRL, conf.int1_ctrl, 4);
+	ispu_emu_write(ISPU_INT2_CTRL, conf.int2_ctrl, 4);
+#ifdef ISPU_DTIME_0
+	// the device provides a quarter of the sample period, as a float split in two 16-bit halves
+	if (conf.rate > 0.0f) {
+		float dtime = 0.25f / conf.rate;
+		uint32_t dt;
+		memcpy(&dt, &dtime, sizeof(dt));
+		ispu_emu_write(ISPU_DTIME_0, dt & 0xFFFFu, 2);
+		ispu_emu_write(ISPU_DTIME_1, dt >> 16, 2);
+	}
+#endif
+
+	write_header(out);
+
+	struct timespec t0, t1;
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+
+	ispu_emu_boot();
+
+	// number of cycles available for each time slot
+	uint64_t budget = conf.rate > 0.0f ? (uint64_t)(conf.clock_mhz * 1e6f / conf.rate) : 0u;
+	struct slot_stats slots = { 0 };
+
+	uint64_t sample = 0;
+	unsigned long line_num = 1;
+	int ret = 0;
+	while (fgets(line, sizeof(line), in) != NULL) {
+		uint32_t values[MAX_COLUMNS];
+		int n = parse_row(line, values, num_columns);
+
+		line_num++;
+		if (n == 0)
+			continue;
+
+		if (n != num_columns) {
+			if (n < 0)
+				fprintf(stderr, "Invalid input at line %lu: value is not a number\n", line_num);
+			else
+				fprintf(stderr, "Invalid input at line %lu: %d values instead of %u\n", line_num, n, num_columns);
+			ret = 1;
+			break;
+		}
+
+		for (uint8_t col = 0; col < num_columns; col++)
+			ispu_emu_write(columns[col]->addr, values[col], 4);
+
+		current_sample = sample;
+
+		uint64_t start_cycles = ispu_emu_cycles();
+		ispu_emu_data_valid();
+		ispu_emu_start_pulse();
+		uint64_t cycles = ispu_emu_cycles() - start_cycles;
+
+		slots.cycles += cycles;
+		if (cycles > slots.cycles_max)
+			slots.cycles_max = cycles;
+		if (budget > 0u && cycles > budget)
+			slots.overruns++;
+
+		if (log_all || (ispu_emu_read(ISPU_INT_PIN, 1) & 0x01u) != 0u)
+			write_outputs(out, sample);
+
+		sample++;
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+
+	if (stats && ret == 0)
+		print_stats(&conf, &slots, (double)(t1.tv_sec - t0.tv_sec) + (double)(t1.tv_nsec - t0.tv_nsec) * 1e-9);
+
+	// the algorithms would not complete within the sample period on the device (which is expected only when the data
+	// valid interrupt collects the samples while the processing of a block spans several time slots)
+	if (ret == 0 && slots.overruns > 0u) {
+		fprintf(stderr, "Warning: %llu of %llu time slots exceed the budget of %llu cycles (%g MHz, %g Hz), "
+		        "longest time slot %llu cycles\n", (unsigned long long)slots.overruns, (unsigned long long)sample,
+		        (unsigned long long)budget, (double)conf.clock_mhz, (double)conf.rate,
+		        (unsigned long long)slots.cycles_max);
+	}
+
+	// the ISPU cannot keep up with the sample rate, whatever the structure of the program
+	if (ret == 0 && budget > 0u && slots.cycles > budget * sample)
+		fprintf(stderr, "Warning: the estimated average load exceeds the ISPU capacity at %g MHz\n", (double)conf.clock_mhz);
+
+	if (in != stdin)
+		fclose(in);
+	if (out != stdout)
+		fclose(out);
+	if (pulse_file != NULL)
+		fclose(pulse_file);
+
+	return ret;
+}
+
@@ -0,0 +1,228 @@
+##############################################################################
+# Copyright(c) 2026 STMicroelectronics.
+# All rights reserved.
+#
+# This software is licensed under terms that can be found in the LICENSE file
+# in the root directory of this software component.
+# If no LICENSE file comes with this software, it is provided AS-IS.
+##############################################################################
+
+"""Generate a patch updating the ISPU program loaded with a configuration to the one of another configuration.
+
+Both configurations (C header or JSON files generated by ispu_gen) are parsed to get the content of the ISPU RAM they
+write and the registers they set after writing it. The patch is a program image (see ispu_pack.py) containing:
+
+- the ranges of the RAM whose content changes (ranges separated by a few unchanged bytes are merged), written with
+  RAM records (0x08, 0x09), which the loader applies with write_ram, stopping the ISPU clock only during the write;
+- the writes of the registers set after writing the RAM whose final value changes (for example, the output data
+  rate of the sensor or the interrupt routing), preceded by the selection of their page.
+
+The ISPU is not reset, so that the variables of the running program keep their values, unless their initial
+values changed. The patch is meant for updates keeping the layout of the program, such as new thresholds or weights
+of a model: if the code changes, the state of the running program may not be valid for the new code.
+
+The output is a C header (one patch per sensor, ispu_patch_images) or, if its extension is .bin, the binary patches
+one after the other.
+
+Usage:
+  python ispu_diff.py [--gap 16] [--max-burst 4096] [--no-compression] old.h|old.json new.h|new.json
+                      patch.h|patch.bin
+"""
+
+from typing import Dict, List, Tuple
+import argparse
+import bisect
+import sys
+
+from ispu_pack import (MAGIC, VERSION, OP_END, OP_WRITE, OP_RAM, OP_RAM_LZ, PAGE_REG, PAGE_ISPU, PAGE_MASK, MAX_BURST,
+                       Op, compress, expand, optimize, pack, ram_data_register, read_conf, write_h)
+
+# first of the three registers (most significant byte first) setting the RAM address of each sensor
+RAM_ADDR = {"ISM330IS": 0x08, "LSM6DSO16IS": 0x08, "IIS3DWB10IS": 0x07}
+
+GAP = 16
+
+# read and write of the page and clock registers before and after the data, and write of the address
+RAM_WRITE_TRANSACTIONS = 10
+
+
+class Program:
+    """Content of the RAM and registers set by a configuration."""
+
+    def __init__(self, ops: List[Op], ram_addr: int, ram_data: int) -> None:
+        self.ram: Dict[int, int] = {}
+        self.segments: List[Tuple[int, int]] = []  # (first address, length) of each sequence of RAM data writes
+        self.setup: List[Op] = []  # operations before the first RAM write
+        self.start: Dict[Tuple[int, int], int] = {}  # final value of the registers (page, address) set after it
+        self.order: List[Tuple[int, int]] = []
+
+        ispu_page = False
+        address = [0, 0, 0]
+        curr = 0
+        new_segment = True
+        last_ram = -1
+
+        for idx, (op_type, reg, data) in enumerate(ops):
+            if op_type == OP_WRITE and reg == PAGE_REG:
+                ispu_page = (data & PAGE_ISPU) != 0
+            elif op_type == OP_WRITE and ispu_page and ram_addr <= reg < ram_addr + 3:
+                address[reg - ram_addr] = data
+                curr = (address[0] << 16) | (address[1] << 8) | address[2]
+                new_segment = True
+                continue
+            elif op_type == OP_WRITE and ispu_page and reg == ram_data:
+                if new_segment:
+                    self.segments.append((curr, 0))
+                    new_segment = False
+                self.ram[curr] = data
+                self.segments[-1] = (self.segments[-1][0], self.segments[-1][1] + 1)
+                curr += 1
+                last_ram = idx
+                continue
+
+            if last_ram < 0:
+                self.setup.append((op_type, reg, data))
+
+        page = 0
+        for op_type, reg, data in ops[last_ram + 1:]:
+            if op_type != OP_WRITE:
+                continue
+            if reg == PAGE_REG:
+                page = data & PAGE_MASK
+                continue
+            if (page, reg) not in self.start:
+                self.order.append((page, reg))
+            self.start[(page, reg)] = data
+
+    def segment(self, addr: int) -> int:
+        return bisect.bisect_right([start for start, _ in self.segments], addr) - 1
+
+
+def ram_ranges(old: Program, new: Program, gap: int, max_burst: int) -> List[Tuple[int, bytes]]:
+    """Return the ranges (address, data) of the RAM of the new program whose content changes."""
+    ranges: List[Tuple[int, bytearray]] = []
+
+    for addr in sorted(a for a, data in new.ram.items() if old.ram.get(a) != data):
+        if ranges:
+            start, data = ranges[-1]
+            end = start + len(data)
+            mergeable = addr - end <= gap and addr - start < max_burst and \
+                new.segment(addr) == new.segment(start) and all(a in new.ram for a in range(end, addr))
+            if mergeable:
+                data.extend(new.ram[a] for a in range(end, addr + 1))
+                continue
+        ranges.append((addr, bytearray([new.ram[addr]])))
+
+    return [(start, bytes(data)) for start, data in ranges]
+
+
+def ram_record(addr: int, data: bytes, compression: bool) -> bytes:
+    header = addr.to_bytes(3, "little") + len(data).to_bytes(2, "little")
+    packed = compress(data) if compression else data
+    if compression and len(packed) + 2 < len(data):
+        assert expand(packed) == data
+        return bytes([OP_RAM_LZ]) + header + len(packed).to_bytes(2, "little") + packed
+    return bytes([OP_RAM]) + header + data
+
+
+def diff(old: Program, new: Program, gap: int, max_burst: int,
+         compression: bool) -> Tuple[bytes, List[Tuple[int, bytes]], int, int]:
+    """Return the patch, the RAM ranges written, and the number of registers changed and of register writes."""
+    patch = bytearray(MAGIC + bytes([VERSION]))
+
+    ranges = ram_ranges(old, new, gap, max_burst)
+    for addr, data in ranges:
+        patch.extend(ram_record(addr, data, compression))
+
+    regs = [key for key in new.order if old.start.get(key) != new.start[key]]
+    writes = len(regs)
+    page = None
+    for key in regs:
+        if key[0] != page:
+            page = key[0]
+            patch.extend([OP_WRITE, PAGE_REG, page])
+            writes += 1
+        patch.extend([OP_WRITE, key[1], new.start[key]])
+    if page not in (None, 0):
+        patch.extend([OP_WRITE, PAGE_REG, 0])
+        writes += 1
+
+    patch.append(OP_END)
+    return bytes(patch), ranges, len(regs), writes
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("old", help="configuration loaded in the sensor (.h or .json)")
+    parser.add_argument("new", help="configuration to update to (.h or .json)")
+    parser.add_argument("output", help="patch (.h or .bin)")
+    parser.add_argument("--gap", type=int, default=GAP, help="maximum unchanged bytes merged in a RAM range")
+    parser.add_argument("--max-burst", type=int, default=MAX_BURST, help="maximum length of a RAM range (bytes)")
+    parser.add_argument("--no-compression", action="store_true", help="do not compress the RAM ranges")
+    args = parser.parse_args()
+
+    if not 0 < args.max_burst <= 0xFFFF:
+        print("%s: invalid maximum burst length" % args.output, file=sys.stderr)
+        return 1
+
+    try:
+        _, old_sensors = read_conf(args.old)
+        _, new_sensors = read_conf(args.new)
+
+        if [names for names, _ in old_sensors] != [names for names, _ in new_sensors]:
+            raise ValueError("the configurations are not for the same sensors")
+
+        programs = []
+        for (names, old_ops), (_, new_ops) in zip(old_sensors, new_sensors):
+            known = {RAM_ADDR[name.upper()] for name in names if name.upper() in RAM_ADDR}
+            if len(known) != 1:
+                raise ValueError("unknown RAM address register for sensor %s" % "/".join(names))
+            ram_addr = known.pop()
+            ram_data = ram_data_register(names)
+            programs.append((Program(old_ops, ram_addr, ram_data), Program(new_ops, ram_addr, ram_data), new_ops,
+                             ram_data))
+    except (OSError, ValueError, KeyError) as err:
+        print("%s: %s" % (args.new, err), file=sys.stderr)
+        return 1
+
+    patches = []
+    for idx, (old, new, new_ops, ram_data) in enumerate(programs):
+        patch, ranges, regs, writes = diff(old, new, args.gap, args.max_burst, not args.no_compression)
+        patches.append(patch)
+
+        changed = sum(1 for a, data in new.ram.items() if old.ram.get(a) != data)
+        written = sum(len(data) for _, data in ranges)
+        transactions = len(ranges) * RAM_WRITE_TRANSACTIONS + writes
+
+        # loading the new configuration from scratch, with the same image format
+        image, image_transactions = pack(optimize(new_ops)[0], ram_data, args.max_burst, not args.no_compression)
+
+        print("sensor %d: %d bytes of RAM changed, written in %d ranges (%d bytes), %d registers changed" %
+              (idx, changed, len(ranges), written, regs))
+        print("  full image: %d bytes, %d bus transactions, %d bytes of RAM written" %
+              (len(image), image_transactions, len(new.ram)))
+        print("  patch: %d bytes, %d bus transactions, %d bytes of RAM written" % (len(patch), transactions, written))
+
+        if 2 * written > len(new.ram):
+            print("  warning: most of the program changes (the code changed), load the full configuration instead",
+                  file=sys.stderr)
+        if old.setup != new.setup:
+            print("  warning: the operations before the program load differ and are not applied by the patch",
+                  file=sys.stderr)
+        if any(a not in new.ram for a in old.ram):
+            print("  warning: the new program is smaller, the RAM not written by it keeps the old content",
+                  file=sys.stderr)
+        if any(key not in new.start for key in old.start):
+            print("  warning: registers set by the old configuration only are not restored", file=sys.stderr)
+
+    if args.output.endswith(".bin"):
+        with open(args.output, "wb") as f:
+            f.write(b"".join(patches))
+    else:
+        write_h(args.output, "ispu_patch", patches, args.max_burst, "ispu_diff.py")
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,384 @@
+##############################################################################
+# Copyright(c) 2026 STMicroelectronics.
+# All rights reserved.
+#
+# This software is licensed under terms that can be found in the LICENSE file
+# in the root directory of this software component.
+# If no LICENSE file comes with this software, it is provided AS-IS.
+##############################################################################
+
+"""Convert the configuration generated by ispu_gen into a compact program image.
+
+The configuration (C header or JSON file generated by ispu_gen) is a list of register operations, one write per byte
+of the ISPU program. In the image, the consecutive writes to the RAM data register (while the ISPU registers are
+selected) are grouped in burst records, whose payload is compressed with a simple LZ scheme when smaller, so that the
+image can be stored in a fraction of the flash and loaded with one multiple write per burst.
+
+Before packing, the selections of the register page (register 0x01) which have no effect are removed (a selection of
+the page already selected, or a selection immediately followed by another one), and consecutive delays are merged.
+
+Image format (all multi-byte values are little endian):
+
+  "ISPU" <version>                  header (5 bytes), version 1
+  0x00                              end of the image
+  0x01 <address> <data>             write register
+  0x02 <ms>                         delay
+  0x03 <address> <mask>             poll register until all the bits of mask are set
+  0x04 <address> <mask>             poll register until all the bits of mask are reset
+  0x05 <address>                    read register
+  0x06 <address> <len:2> <data>     write len bytes to the same register (multiple write)
+  0x07 <address> <len:2> <clen:2> <data>
+                                    same as 0x06, with the len bytes compressed in clen bytes
+  0x08 <ram_address:3> <len:2> <data>
+                                    write len bytes to the ISPU RAM, while the ISPU is running (patches generated
+                                    by ispu_diff.py)
+  0x09 <ram_address:3> <len:2> <clen:2> <data>
+                                    same as 0x08, with the len bytes compressed in clen bytes
+
+The compressed payload is a sequence of tokens: a byte t < 0x80 is followed by t + 1 literal bytes, a byte t >= 0x80
+is followed by a 2-byte distance d and copies (t & 0x7F) + 3 bytes starting d bytes back in the output (the copy may
+overlap the bytes being written, which covers runs of the same value). A burst is at most MAX_BURST bytes, so that
+it can be expanded in a buffer of that size.
+
+The RAM data register is known from the name of the sensor (ISM330IS, LSM6DSO16IS, IIS3DWB10IS) or can be
+specified. The output is a C header (one image per sensor, ispu_conf_images by default) or, if its extension is .bin,
+the binary images one after the other.
+
+Usage:
+  python ispu_pack.py [--ram-data <register>] [--max-burst 4096] [--no-compression] input.h|input.json
+                      output.h|output.bin
+"""
+
+from typing import Dict, List, Tuple
+import argparse
+import json
+import os
+import re
+import sys
+
+MAGIC = b"ISPU"
+VERSION = 1
+
+OP_END = 0x00
+OP_WRITE = 0x01
+OP_DELAY = 0x02
+OP_POLL_SET = 0x03
+OP_POLL_RESET = 0x04
+OP_READ = 0x05
+OP_BURST = 0x06
+OP_BURST_LZ = 0x07
+OP_RAM = 0x08
+OP_RAM_LZ = 0x09
+
+# register selecting the ISPU registers (bit 7) and RAM data register of the ISPU of each sensor
+PAGE_REG = 0x01
+PAGE_ISPU = 0x80
+PAGE_MASK = 0xC0
+RAM_DATA = {"ISM330IS": 0x0B, "LSM6DSO16IS": 0x0B, "IIS3DWB10IS": 0x0A}
+
+MAX_BURST = 4096
+MAX_DELAY = 0xFF
+
+MIN_MATCH = 3
+MAX_MATCH = 0x7F + MIN_MATCH
+MAX_LITERALS = 0x80
+MAX_CHAIN = 64
+
+TYPES = {"read": OP_READ, "write": OP_WRITE, "delay": OP_DELAY, "poll_set": OP_POLL_SET, "poll_reset": OP_POLL_RESET}
+H_TYPES = {"READ": OP_READ, "WRITE": OP_WRITE, "DELAY": OP_DELAY, "POLL_SET": OP_POLL_SET,
+           "POLL_RESET": OP_POLL_RESET}
+
+H_LIST_RE = re.compile(r"static const struct mems_conf_op (\w+)\[\] = \{(.*?)\n\};", re.DOTALL)
+H_OP_RE = re.compile(r"\{ \.type = MEMS_CONF_OP_TYPE_(\w+), \.address = (\w+), \.data = (\w+) \}")
+H_CONFS_RE = re.compile(r"static const struct mems_conf_op_list (\w+)_confs\[\w+\] = \{(.*?)\n\};", re.DOTALL)
+
+Op = Tuple[int, int, int]
+Sensor = Tuple[List[str], List[Op]]
+
+
+def read_h(path: str) -> Tuple[str, List[Sensor]]:
+    with open(path, "r", encoding="utf-8") as f:
+        src = f.read()
+
+    lists = {}
+    for match in H_LIST_RE.finditer(src):
+        lists[match.group(1)] = [(H_TYPES[t], int(a, 0), int(d, 0)) for t, a, d in H_OP_RE.findall(match.group(2))]
+
+    confs = H_CONFS_RE.search(src)
+    if confs is None:
+        raise ValueError("configuration list not found")
+
+    prefix = confs.group(1)
+    sensors = []
+    for idx, name in enumerate(re.findall(r"\.list = (\w+)", confs.group(2))):
+        names = re.search(r"static const char \*const %s_names_%d\[\] = \{(.*?)\};" % (prefix, idx), src, re.DOTALL)
+        sensors.append((re.findall(r'"(\w+)"', names.group(1)) if names else [], lists[name]))
+
+    return prefix, sensors
+
+
+def read_json(path: str) -> Tuple[str, List[Sensor]]:
+    with open(path, "r", encoding="utf-8") as f:
+        conf = json.load(f)
+
+    sensors = []
+    for sensor in conf["sensors"]:
+        ops = []
+        for op in sensor["configuration"]:
+            if "type" not in op:
+                continue
+            ops.append((TYPES[op["type"]], int(op.get("address", "0"), 0), int(op.get("data", "0"), 0)))
+        sensors.append((sensor["name"], ops))
+
+    return "ispu_conf", sensors
+
+
+def read_conf(path: str) -> Tuple[str, List[Sensor]]:
+    if path.endswith(".json"):
+        return read_json(path)
+    return read_h(path)
+
+
+def ram_data_register(names: List[str]) -> int:
+    known = {RAM_DATA[name.upper()] for name in names if name.upper() in RAM_DATA}
+    if len(known) != 1:
+        raise ValueError("unknown RAM data register for sensor %s, use --ram-data" % "/".join(names))
+    return known.pop()
+
+
+def compress(data: bytes) -> bytes:
+    """Greedy LZ compression, with hash chains on the first MIN_MATCH bytes."""
+    out = bytearray()
+    literals = bytearray()
+    chains: Dict[bytes, List[int]] = {}
+
+    def flush() -> None:
+        for i in range(0, len(literals), MAX_LITERALS):
+            chunk = literals[i:i + MAX_LITERALS]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+        literals.clear()
+
+    pos = 0
+    while pos < len(data):
+        best_len = 0
+        best_dist = 0
+        key = data[pos:pos + MIN_MATCH]
+        if len(key) == MIN_MATCH:
+            limit = min(MAX_MATCH, len(data) - pos)
+            for cand in reversed(chains.get(key, [])[-MAX_CHAIN:]):
+                length = 0
+                while length < limit and data[cand + length] == data[pos + length]:
+                    length += 1
+                if length > best_len:
+                    best_len = length
+                    best_dist = pos - cand
+                    if length == limit:
+                        break
+
+        step = best_len if best_len >= MIN_MATCH else 1
+        for i in range(pos, pos + step):
+            chains.setdefault(data[i:i + MIN_MATCH], []).append(i)
+
+        if best_len >= MIN_MATCH:
+            flush()
+            out.append(0x80 | (best_len - MIN_MATCH))
+            out.extend(best_dist.to_bytes(2, "little"))
+        else:
+            literals.append(data[pos])
+        pos += step
+
+    flush()
+    return bytes(out)
+
+
+def expand(data: bytes) -> bytes:
+    out = bytearray()
+    pos = 0
+    while pos < len(data):
+        token = data[pos]
+        if token < 0x80:
+            out.extend(data[pos + 1:pos + 2 + token])
+            pos += 2 + token
+        else:
+            dist = int.from_bytes(data[pos + 1:pos + 3], "little")
+            for _ in range((token & 0x7F) + MIN_MATCH):
+                out.append(out[-dist])
+            pos += 3
+    return bytes(out)
+
+
+def optimize(ops: List[Op]) -> Tuple[List[Op], int, int]:
+    """Return the operations without the useless page selections and with merged delays, and the number of
+    page selections removed and delays merged."""
+    out: List[Op] = []
+    page = None
+    pages_removed = 0
+    delays_merged = 0
+
+    for idx, (op_type, address, data) in enumerate(ops):
+        if op_type == OP_WRITE and address == PAGE_REG and (data & ~PAGE_MASK) == 0:
+            # the other bits of the register trigger actions (reset of the ISPU), only pure selections are removed
+            following = ops[idx + 1] if idx + 1 < len(ops) else None
+            overwritten = following is not None and following[0] == OP_WRITE and following[1] == PAGE_REG and \
+                (following[2] & ~PAGE_MASK) == 0
+            if data == page or overwritten:
+                pages_removed += 1
+                continue
+
+        if op_type == OP_DELAY and out and out[-1][0] == OP_DELAY and out[-1][2] + data <= MAX_DELAY:
+            out[-1] = (OP_DELAY, 0, out[-1][2] + data)
+            delays_merged += 1
+            continue
+
+        if op_type == OP_WRITE and address == PAGE_REG:
+            page = data if (data & ~PAGE_MASK) == 0 else None
+        elif op_type != OP_WRITE:
+            # the delays and polls wait for resets, after which the selected page is not known
+            page = None
+        out.append((op_type, address, data))
+
+    return out, pages_removed, delays_merged
+
+
+def burst_record(address: int, data: bytes, compression: bool) -> bytes:
+    packed = compress(data) if compression else data
+    if compression and len(packed) + 2 < len(data):
+        assert expand(packed) == data
+        return bytes([OP_BURST_LZ, address]) + len(data).to_bytes(2, "little") + \
+            len(packed).to_bytes(2, "little") + packed
+    return bytes([OP_BURST, address]) + len(data).to_bytes(2, "little") + data
+
+
+def pack(ops: List[Op], ram_data: int, max_burst: int, compression: bool) -> Tuple[bytes, int]:
+    """Return the image and the number of bus transactions needed to load it."""
+    image = bytearray(MAGIC + bytes([VERSION]))
+    burst = bytearray()
+    transactions = 0
+    ispu_page = False
+
+    def flush() -> None:
+        nonlocal transactions
+        for i in range(0, len(burst), max_burst):
+            image.extend(burst_record(ram_data, bytes(burst[i:i + max_burst]), compression))
+            transactions += 1
+        burst.clear()
+
+    for op_type, address, data in ops:
+        if op_type == OP_WRITE and ispu_page and address == ram_data:
+            burst.append(data)
+            continue
+
+        flush()
+        if op_type == OP_WRITE:
+            if address == PAGE_REG:
+                ispu_page = (data & PAGE_ISPU) != 0
+            image.extend([OP_WRITE, address, data])
+        elif op_type == OP_DELAY:
+            image.extend([OP_DELAY, data])
+        elif op_type == OP_READ:
+            image.extend([OP_READ, address])
+        else:
+            image.extend([op_type, address, data])
+        if op_type != OP_DELAY:
+            transactions += 1
+
+    flush()
+    image.append(OP_END)
+    return bytes(image), transactions
+
+
+def write_h(path: str, prefix: str, images: List[bytes], max_burst: int, generator: str = "ispu_pack.py") -> None:
+    guard = re.sub(r"\W", "_", os.path.basename(path)).upper()
+    out = ["/* Generated by %s, do not edit */" % generator,
+           "",
+           "#ifndef %s" % guard,
+           "#define %s" % guard,
+           "",
+           "#ifdef __cplusplus",
+           "extern \"C\" {",
+           "#endif",
+           "",
+           "#include <stdint.h>",
+           "",
+           "#ifndef ISPU_IMAGE_SHARED_TYPES",
+           "#define ISPU_IMAGE_SHARED_TYPES",
+           "",
+           "struct ispu_image {",
+           "\tconst uint8_t *data;",
+           "\tuint32_t len;",
+           "};",
+           "",
+           "#endif /* ISPU_IMAGE_SHARED_TYPES */",
+           "",
+           "#define %s_IMAGES_NUM %d" % (prefix.upper(), len(images)),
+           "#define %s_IMAGE_MAX_BURST %d" % (prefix.upper(), max_burst),
+           ""]
+
+    for idx, image in enumerate(images):
+        out.append("static const uint8_t %s_image_%d[] = {" % (prefix, idx))
+        for i in range(0, len(image), 16):
+            out.append("\t" + " ".join("0x%02X," % b for b in image[i:i + 16]))
+        out += ["};", ""]
+
+    out.append("static const struct ispu_image %s_images[%s_IMAGES_NUM] = {" % (prefix, prefix.upper()))
+    out += ["\t{ .data = %s_image_%d, .len = sizeof(%s_image_%d) }," % (prefix, idx, prefix, idx)
+            for idx in range(len(images))]
+    out += ["};",
+            "",
+            "#ifdef __cplusplus",
+            "}",
+            "#endif",
+            "",
+            "#endif /* %s */" % guard,
+            ""]
+
+    with open(path, "w", encoding="utf-8", newline="\n") as f:
+        f.write("\n".join(out))
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("input", help="configuration generated by ispu_gen (.h or .json)")
+    parser.add_argument("output", help="program image (.h or .bin)")
+    parser.add_argument("--ram-data", type=lambda x: int(x, 0),
+                        help="RAM data register of the ISPU (default: known from the sensor name)")
+    parser.add_argument("--max-burst", type=int, default=MAX_BURST, help="maximum length of a burst (bytes)")
+    parser.add_argument("--no-compression", action="store_true",
+                        help="do not compress the bursts (they can be written directly from the image)")
+    args = parser.parse_args()
+
+    if not 0 < args.max_burst <= 0xFFFF:
+        print("%s: invalid maximum burst length" % args.input, file=sys.stderr)
+        return 1
+
+    try:
+        prefix, sensors = read_conf(args.input)
+        ram_data = [args.ram_data if args.ram_data is not None else ram_data_register(names) for names, _ in sensors]
+    except (OSError, ValueError, KeyError) as err:
+        print("%s: %s" % (args.input, err), file=sys.stderr)
+        return 1
+
+    images = []
+    for idx, (_, ops) in enumerate(sensors):
+        optimized, pages_removed, delays_merged = optimize(ops)
+        image, transactions = pack(optimized, ram_data[idx], args.max_burst, not args.no_compression)
+        images.append(image)
+
+        # each operation of the configuration takes 3 bytes of flash (struct mems_conf_op)
+        bus_ops = sum(1 for op in ops if op[0] != OP_DELAY)
+        print("sensor %d: %d operations (%d bytes) -> image of %d bytes" % (idx, len(ops), 3 * len(ops), len(image)))
+        print("  bus transactions: %d -> %d (%d page selections removed, %d delays merged)" %
+              (bus_ops, transactions, pages_removed, delays_merged))
+
+    if args.output.endswith(".bin"):
+        with open(args.output, "wb") as f:
+            f.write(b"".join(images))
+    else:
+        write_h(args.output, prefix, images, args.max_burst)
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,270 @@
+##############################################################################
+# Copyright(c) 2026 STMicroelectronics.
+# All rights reserved.
+#
+# This software is licensed under terms that can be found in the LICENSE file
+# in the root directory of this software component.
+# If no LICENSE file comes with this software, it is provided AS-IS.
+##############################################################################
+
+"""Decode the binary output of the test firmware using ISPU C header file.
+
+When the binary output is enabled (*bin 1 command), the firmware sends the raw bytes of the ISPU output registers at
+each interrupt, in frames made of (all multi-byte values are little endian):
+
+  0xA5 0x5A | payload length (2) | sequence number (2) | timestamp in us (4) | payload | CRC-16/CCITT-FALSE (2)
+
+where the payload contains the outputs described by the metadata of the ISPU configuration, in the same order, and
+the CRC covers the bytes from the payload length to the end of the payload. The outputs are decoded using the same
+metadata (C header or JSON file generated by ispu_gen) and written as tab-separated columns, with the same header as
+the text output of the firmware, preceded by the timestamp.
+
+The frames are read from a serial port (pyserial is needed), on which the binary output is enabled at start and
+disabled at exit, or from a file containing the bytes previously captured.
+
+Usage:
+  python ispu_stream.py [--port PORT [--baud 921600] | --input capture.bin] [--no-labels] ispu.h|ispu.json
+                        [output.tsv]
+"""
+
+from typing import BinaryIO, Dict, Iterator, List, Optional, Tuple
+import argparse
+import json
+import re
+import struct
+import sys
+
+SYNC = b"\xA5\x5A"
+HEADER_SIZE = 10
+CRC_SIZE = 2
+
+# struct format of each output type (ispu_gen names), the size follows from the format
+FORMATS = {
+    "uint8_t": "B", "int8_t": "b", "char": "c", "uint16_t": "H", "int16_t": "h", "uint32_t": "I", "int32_t": "i",
+    "uint64_t": "Q", "int64_t": "q", "half": "e", "float": "f", "double": "d",
+}
+
+
+class Output:
+    """Output described by the metadata of the configuration."""
+
+    def __init__(self, name: str, out_type: str, length: int, labels: Dict[int, str]) -> None:
+        if out_type not in FORMATS:
+            raise ValueError("unknown type %s of output %s" % (out_type, name))
+        self.name = name
+        self.type = out_type
+        self.len = length
+        self.labels = labels
+        self.size = struct.calcsize("<" + FORMATS[out_type]) * length
+
+    def columns(self) -> List[str]:
+        # char arrays are strings, printed in one column
+        if self.len == 1 or self.type == "char":
+            return [self.name]
+        return ["%s[%d]" % (self.name, k) for k in range(self.len)]
+
+    def format(self, data: bytes, labels: bool) -> List[str]:
+        if self.type == "char":
+            return [data.split(b"\0", 1)[0].decode("ascii", "replace")]
+
+        values = struct.unpack("<%d%s" % (self.len, FORMATS[self.type]), data)
+        out = []
+        for value in values:
+            if isinstance(value, float):
+                text = "%f" % value
+            else:
+                text = "%d" % value
+            if labels and self.type == "uint8_t" and value in self.labels:
+                text += " (%s)" % self.labels[value]
+            out.append(text)
+        return out
+
+
+def read_json(path: str) -> List[Output]:
+    with open(path, "r", encoding="utf-8") as f:
+        conf = json.load(f)
+
+    outputs = []
+    for sensor in conf["sensors"]:
+        for out in sensor.get("outputs", []):
+            labels = {int(res["code"], 0): res["label"] for res in out.get("results", [])}
+            outputs.append(Output(out["name"], out["type"], int(out["len"], 0), labels))
+
+    return outputs
+
+
+def read_h(path: str) -> List[Output]:
+    with open(path, "r", encoding="utf-8") as f:
+        text = f.read()
+
+    results = {}
+    for match in re.finditer(r"static const struct mems_conf_result (\w+)\[\] = \{(.*?)\n\};", text, re.DOTALL):
+        results[match.group(1)] = {int(code, 0): label for code, label in
+                                   re.findall(r'\.code = (\w+), \.label = "(.*?)"', match.group(2))}
+
+    # the output lists of the sensors, in the order of ispu_conf_output_lists
+    lists = re.search(r"mems_conf_output_list \w+\[\w+\] = \{(.*?)\n\};", text, re.DOTALL)
+    if lists is None:
+        raise ValueError("output lists not found")
+
+    outputs = []
+    for list_name in re.findall(r"\.list = (\w+)", lists.group(1)):
+        if list_name == "NULL":  # sensor without outputs
+            continue
+        body = re.search(r"static const struct mems_conf_output %s\[\] = \{(.*?)\n\};" % list_name, text, re.DOTALL)
+        if body is None:
+            raise ValueError("output list %s not found" % list_name)
+        for entry in re.findall(r"\{(.*?)\n\t\}", body.group(1), re.DOTALL):
+            fields = dict(re.findall(r"\.(\w+) = (\"[^\"]*\"|\w+)", entry))
+            out_type = fields["type"].replace("MEMS_CONF_OUTPUT_TYPE_", "").lower()
+            labels = results.get(fields.get("results", "NULL"), {})
+            outputs.append(Output(fields["name"].strip('"'), out_type, int(fields["len"], 0), labels))
+
+    return outputs
+
+
+def crc16(data: bytes) -> int:
+    crc = 0xFFFF
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else crc << 1
+            crc &= 0xFFFF
+    return crc
+
+
+class Decoder:
+    """Extract the frames with the expected payload size and a valid CRC from a byte stream."""
+
+    def __init__(self, payload_size: int) -> None:
+        self.payload_size = payload_size
+        self.buf = bytearray()
+        self.seq: Optional[int] = None
+        self.frames = 0
+        self.lost = 0
+        self.crc_errors = 0
+        self.skipped = 0
+
+    def feed(self, data: bytes) -> Iterator[Tuple[int, bytes]]:
+        """Yield the timestamp and the payload of the complete frames received so far."""
+        self.buf.extend(data)
+        frame_size = HEADER_SIZE + self.payload_size + CRC_SIZE
+
+        while True:
+            start = self.buf.find(SYNC)
+            if start < 0:
+                # keep the last byte, which may be the first sync byte
+                keep = 1 if self.buf[-1:] == SYNC[:1] else 0
+                self.skipped += len(self.buf) - keep
+                del self.buf[:len(self.buf) - keep]
+                return
+            if start > 0:
+                self.skipped += start
+                del self.buf[:start]
+            if len(self.buf) < HEADER_SIZE:
+                return
+
+            length, seq, timestamp = struct.unpack_from("<HHI", self.buf, 2)
+            if length != self.payload_size:  # not a frame (text, or sync bytes in the data)
+                self.skipped += 1
+                del self.buf[:1]
+                continue
+            if len(self.buf) < frame_size:
+                return
+
+            crc = struct.unpack_from("<H", self.buf, HEADER_SIZE + length)[0]
+            if crc != crc16(self.buf[2:HEADER_SIZE + length]):
+                self.crc_errors += 1
+                self.skipped += 1
+                del self.buf[:1]
+                continue
+
+            if self.seq is not None:
+                self.lost += (seq - self.seq - 1) & 0xFFFF
+            self.seq = seq
+            self.frames += 1
+
+            payload = bytes(self.buf[HEADER_SIZE:HEADER_SIZE + length])
+            del self.buf[:frame_size]
+            yield timestamp, payload
+
+
+def decode(source: BinaryIO, outputs: List[Output], out, labels: bool, decoder: Decoder) -> None:
+    out.write("\t".join(["Timestamp [us]"] + [col for o in outputs for col in o.columns()]) + "\n")
+
+    while True:
+        data = source.read(4096)
+        if not data:
+            break
+        for timestamp, payload in decoder.feed(data):
+            row = ["%d" % timestamp]
+            offset = 0
+            for o in outputs:
+                row.extend(o.format(payload[offset:offset + o.size], labels))
+                offset += o.size
+            out.write("\t".join(row) + "\n")
+        out.flush()
+
+
+class SerialSource:
+    """Serial port on which the binary output of the firmware is enabled while reading."""
+
+    def __init__(self, port: str, baud: int) -> None:
+        import serial  # only needed to read from a serial port
+
+        self.port = serial.Serial(port, baud, timeout=0.1)
+        self.port.write(b"*bin 1\n")
+
+    def read(self, size: int) -> bytes:
+        data = b""
+        while not data:
+            data = self.port.read(size)
+        return data
+
+    def close(self) -> None:
+        self.port.write(b"*bin 0\n")
+        self.port.close()
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("meta", help="configuration generated by ispu_gen (.h or .json), containing the outputs")
+    parser.add_argument("output", nargs="?", help="decoded outputs (.tsv), standard output if not specified")
+    parser.add_argument("--port", help="serial port of the Nucleo board")
+    parser.add_argument("--baud", type=int, default=921600, help="baud rate of the serial port")
+    parser.add_argument("--input", help="file containing the bytes captured from the serial port")
+    parser.add_argument("--no-labels", action="store_true", help="do not print the labels of the output values")
+    args = parser.parse_args()
+
+    if (args.port is None) == (args.input is None):
+        print("%s: specify either --port or --input" % args.meta, file=sys.stderr)
+        return 1
+
+    try:
+        outputs = read_json(args.meta) if args.meta.endswith(".json") else read_h(args.meta)
+        if not outputs:
+            raise ValueError("no outputs")
+    except (OSError, ValueError, KeyError) as err:
+        print("%s: %s" % (args.meta, err), file=sys.stderr)
+        return 1
+
+    decoder = Decoder(sum(o.size for o in outputs))
+    source = SerialSource(args.port, args.baud) if args.port else open(args.input, "rb")
+    out = open(args.output, "w", encoding="utf-8") if args.output else sys.stdout
+
+    try:
+        decode(source, outputs, out, not args.no_labels, decoder)
+    except KeyboardInterrupt:
+        pass
+    finally:
+        source.close()
+        if args.output:
+            out.close()
+
+    print("%d frames, %d lost, %d CRC errors, %d bytes skipped" %
+          (decoder.frames, decoder.lost, decoder.crc_errors, decoder.skipped), file=sys.stderr)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,308 @@
+##############################################################################
+# Copyright(c) 2026 STMicroelectronics.
+# All rights reserved.
+#
+# This software is licensed under terms that can be found in the LICENSE file
+# in the root directory of this software component.
+# If no LICENSE file comes with this software, it is provided AS-IS.
+##############################################################################
+
+"""Report the RAM used by the network generated by ST Edge AI Core for the ISPU and plan the input and output buffers.
+
+The lifetime of each tensor (from the node producing it to the last node using it) is computed from
+inc/network_details.h, and its location from the buffers used by each node in src/network.c. The report lists the
+tensors and the RAM statically allocated by init_network_buffers (network_utils.c).
+
+When the input or output buffers are not allocated inside the activations buffer by ST Edge AI Core (generated with
+--no-inputs-allocation or --no-outputs-allocation), network_utils.c allocates them in separate buffers. This script
+places them inside the activations buffer instead, where no tensor in use at the same time is located (the
+activations buffer is extended if needed), and adds the offsets to inc/network.h, so that network_utils.c sets them
+as if they were allocated by ST Edge AI Core (STAI_FLAG_INPUTS, STAI_FLAG_OUTPUTS).
+
+The files are modified in place and can be processed again after being regenerated (the code previously added is
+replaced).
+
+Usage:
+  python stai_plan.py path/to/ispu
+"""
+
+from typing import Dict, List, Optional, Tuple
+import os
+import re
+import sys
+
+BEGIN_MARK = "/* STAI_PLAN BEGIN (added by stai_plan.py, do not edit) */"
+END_MARK = "/* STAI_PLAN END */"
+HDR_INSERT = "STAI_API_DECLARE_END"
+
+SECTION_RE = re.compile(r"/\* LITE_KERNEL_SECTION BEGIN (\w+) \*/\n(.*?)/\* LITE_KERNEL_SECTION END \1 \*/", re.DOTALL)
+CALL_RE = re.compile(r"(forward_lite_\w+)\(net_ctx\);")
+BUF_RE = re.compile(r"net_ctx->_(activations|inputs|outputs)\[(\d+)\] \+ (\d+)\)")
+TENSOR_RE = re.compile(r"\{ \.size_bytes = (\d+),.*?\.name = \"(\w+)\" \}")
+NODE_RE = re.compile(r"\.input_tensors = \{(\d+), \(const int32_t\[\d+\]\)\{([\d, ]+)\}\}, "
+                     r"\.output_tensors = \{(\d+), \(const int32_t\[\d+\]\)\{([\d, ]+)\}\} \},? /\* (\w+) \*/")
+
+# location of a tensor: buffer kind ("activations", "inputs", "outputs"), buffer index, offset
+Location = Tuple[str, int, int]
+
+
+class Tensor:
+    def __init__(self, idx: int, name: str, size: int) -> None:
+        self.idx = idx
+        self.name = name
+        self.size = size
+        self.first = None  # type: Optional[int]
+        self.last = None  # type: Optional[int]
+        self.loc = None  # type: Optional[Location]
+        self.external = None  # type: Optional[str]
+
+
+def strip_previous(src: str) -> str:
+    begin = src.find(BEGIN_MARK)
+    if begin < 0:
+        return src
+    end = src.index(END_MARK, begin) + len(END_MARK)
+    return src[:begin] + src[end:].lstrip("\n")
+
+
+def define(hdr: str, name: str) -> str:
+    match = re.search(r"#define %s\s+(.*?)\s*$" % name, hdr, re.MULTILINE)
+    if match is None:
+        raise ValueError("%s not found" % name)
+    return match.group(1)
+
+
+def define_int(hdr: str, name: str) -> int:
+    return int(define(hdr, name).strip("()"))
+
+
+def node_buffers(src: str, code: str) -> Tuple[List[Location], List[Location]]:
+    """Return the buffers read and written by the code of a node, in the order of its input and output tensors."""
+    # the pooling layers are run through a function setting the data of the input and output arrays
+    call = CALL_RE.search(code)
+    if call is not None:
+        match = re.search(r"void %s\(_stai_network_context\* net_ctx\)\n\{\n(.*?)\n\}" % call.group(1), src, re.DOTALL)
+        if match is None:
+            raise ValueError("%s not found" % call.group(1))
+        data = [BUF_RE.search(line) for line in match.group(1).split("\n") if "_output_array.data =" in line]
+        locs = [(m.group(1), int(m.group(2)), int(m.group(3))) for m in data if m is not None]
+        return locs[:-1], locs[-1:]
+
+    ins = {}  # type: Dict[int, Location]
+    outs = {}  # type: Dict[int, Location]
+    for line in code.split("\n"):
+        buf = BUF_RE.search(line)
+        if buf is None or "_CB(" in line:
+            continue
+        loc = (buf.group(1), int(buf.group(2)), int(buf.group(3)))
+        role = re.search(r"_t_(in|out)_(\d+)_ptr|\.(input|output) =", line)
+        if role is None:
+            continue
+        if role.group(1) is not None:
+            (ins if role.group(1) == "in" else outs)[int(role.group(2))] = loc
+        else:
+            (ins if role.group(3) == "input" else outs)[0] = loc
+    return [ins[k] for k in sorted(ins)], [outs[k] for k in sorted(outs)]
+
+
+def parse(ispu: str) -> Tuple[str, List[Tensor], int]:
+    with open(os.path.join(ispu, "inc", "network.h"), "r", encoding="utf-8") as f:
+        hdr = strip_previous(f.read())
+    with open(os.path.join(ispu, "inc", "network_details.h"), "r", encoding="utf-8") as f:
+        details = f.read()
+    with open(os.path.join(ispu, "src", "network.c"), "r", encoding="utf-8") as f:
+        src = f.read()
+
+    tensors = [Tensor(i, m.group(2), int(m.group(1))) for i, m in enumerate(TENSOR_RE.finditer(details))]
+    nodes = [(m.group(5), [int(t) for t in m.group(2).split(",")], [int(t) for t in m.group(4).split(",")])
+             for m in NODE_RE.finditer(details)]
+    sections = dict((m.group(1), m.group(2)) for m in SECTION_RE.finditer(src))
+
+    if len(nodes) != define_int(hdr, "STAI_NETWORK_NODES_NUM"):
+        raise ValueError("the nodes of network_details.h do not match STAI_NETWORK_NODES_NUM")
+
+    for n, (name, ins, outs) in enumerate(nodes):
+        if name not in sections:
+            raise ValueError("node %s not found in network.c" % name)
+        in_locs, out_locs = node_buffers(src, sections[name])
+        for t, loc in list(zip(ins, in_locs)) + list(zip(outs, out_locs)):
+            tensors[t].loc = loc
+        for t in ins:
+            tensors[t].last = n
+        for t in outs:
+            if tensors[t].first is None:
+                tensors[t].first = n
+
+    # the inputs and outputs allocated by ST Edge AI Core are located inside the activations buffer
+    for m in re.finditer(r"net_ctx->_(inputs|outputs)\[(\d+)\] = activations\[(\d+)\] \+ (\d+);", src):
+        for t in tensors:
+            if t.loc is not None and t.loc[:2] == (m.group(1), int(m.group(2))):
+                t.loc = ("activations", int(m.group(3)), int(m.group(4)) + t.loc[2])
+                t.external = m.group(1)
+
+    # the inputs are written before running the network, the outputs are read after
+    for t in tensors:
+        if t.first is None:
+            t.first = -1
+        if t.last is None or (t.loc is not None and t.loc[0] == "outputs") or t.external == "outputs":
+            t.last = len(nodes)
+
+    return hdr, tensors, len(nodes)
+
+
+def overlaps(a: Tensor, b: Tensor) -> bool:
+    return a.first <= b.last and b.first <= a.last
+
+
+def place(tensor: Tensor, busy: List[Tuple[int, int, Tensor]], align: int) -> int:
+    """Return the lowest aligned offset in the activations buffer free during the lifetime of the tensor."""
+    offset = 0
+    for start, end, other in sorted(busy, key=lambda b: b[0]):
+        if not overlaps(tensor, other) or end <= offset:
+            continue
+        if start >= offset + tensor.size:
+            break
+        offset = (end + align - 1) // align * align
+    return offset
+
+
+def plan(hdr: str, tensors: List[Tensor]) -> Tuple[Optional[List[int]], Optional[List[int]], int]:
+    flags = define(hdr, "STAI_NETWORK_FLAGS")
+    act_size = define_int(hdr, "STAI_NETWORK_ACTIVATIONS_SIZE_BYTES")
+    plan_size = act_size
+
+    # the buffers are placed relative to a single activations buffer allocated by network_utils.c
+    if "STAI_FLAG_ACTIVATIONS" in flags or define_int(hdr, "STAI_NETWORK_ACTIVATIONS_NUM") != 1:
+        return None, None, plan_size
+
+    busy = [(t.loc[2], t.loc[2] + t.size, t) for t in tensors if t.loc is not None and t.loc[0] == "activations"]
+    planned = []  # type: List[Optional[List[int]]]
+
+    for kind, prefix, flag in (("inputs", "IN", "STAI_FLAG_INPUTS"), ("outputs", "OUT", "STAI_FLAG_OUTPUTS")):
+        num = define_int(hdr, "STAI_NETWORK_%s_NUM" % prefix)
+        ext = dict((t.loc[1], t) for t in tensors if t.loc is not None and t.loc[0] == kind)
+        if flag in flags or len(ext) != num or any(t.loc[2] != 0 for t in ext.values()):
+            planned.append(None)
+            continue
+
+        offsets = []
+        for i in range(num):
+            tensor = ext[i]
+            align = define_int(hdr, "STAI_NETWORK_%s_%d_ALIGNMENT" % (prefix, i + 1))
+            offset = place(tensor, busy, align)
+            busy.append((offset, offset + tensor.size, tensor))
+            plan_size = max(plan_size, offset + tensor.size)
+            offsets.append(offset)
+        planned.append(offsets)
+
+    return planned[0], planned[1], plan_size
+
+
+def report(hdr: str, tensors: List[Tensor], num_nodes: int, in_offsets: Optional[List[int]],
+           out_offsets: Optional[List[int]], plan_size: int) -> List[str]:
+    flags = define(hdr, "STAI_NETWORK_FLAGS")
+    act_size = define_int(hdr, "STAI_NETWORK_ACTIVATIONS_SIZE_BYTES")
+    in_size = define_int(hdr, "STAI_NETWORK_IN_SIZE_BYTES")
+    out_size = define_int(hdr, "STAI_NETWORK_OUT_SIZE_BYTES")
+    states_size = define_int(hdr, "STAI_NETWORK_STATES_SIZE_BYTES")
+
+    def resolve(t: Tensor) -> Optional[Location]:
+        if t.loc is None:
+            return None
+        kind, idx, offset = t.loc
+        if kind == "inputs" and in_offsets is not None:
+            return ("activations", 0, in_offsets[idx] + offset)
+        if kind == "outputs" and out_offsets is not None:
+            return ("activations", 0, out_offsets[idx] + offset)
+        return t.loc
+
+    def where(t: Tensor) -> str:
+        loc = resolve(t)
+        if loc is None:
+            return "unknown"
+        return "%s[%d] %d-%d" % (loc[0], loc[1], loc[2], loc[2] + t.size - 1)
+
+    def when(n: int) -> str:
+        return "before" if n < 0 else ("after" if n >= num_nodes else str(n))
+
+    lines = ["%-32s %8s  %-24s %s" % ("tensor", "bytes", "location", "lifetime (nodes)")]
+    for t in tensors:
+        lines.append("%-32s %8d  %-24s %s-%s" % (t.name, t.size, where(t), when(t.first), when(t.last)))
+
+    # bytes of the activations buffer in use at each node (the tensors computed in place share the same bytes)
+    used = []
+    for n in range(num_nodes):
+        locs = [(resolve(t), t) for t in tensors if t.first <= n <= t.last]
+        ranges = sorted((loc[2], loc[2] + t.size) for loc, t in locs if loc is not None and loc[0] == "activations")
+        total, end = 0, 0
+        for start, stop in ranges:
+            total += max(0, stop - max(start, end))
+            end = max(end, stop)
+        used.append(total)
+    peak = max(used)
+
+    separate = act_size
+    if "STAI_FLAG_ACTIVATIONS" in flags:
+        separate = 0
+    if "STAI_FLAG_INPUTS" not in flags:
+        separate += in_size
+    if "STAI_FLAG_OUTPUTS" not in flags:
+        separate += out_size
+    separate += states_size
+
+    planned = plan_size if "STAI_FLAG_ACTIVATIONS" not in flags else 0
+    if "STAI_FLAG_INPUTS" not in flags and in_offsets is None:
+        planned += in_size
+    if "STAI_FLAG_OUTPUTS" not in flags and out_offsets is None:
+        planned += out_size
+    planned += states_size
+
+    lines += ["",
+              "activations in use (peak): %d bytes at node %d" % (peak, used.index(peak)),
+              "activations buffer: %d bytes" % act_size,
+              "inputs: %s" % ("in activations (ST Edge AI Core)" if "STAI_FLAG_INPUTS" in flags else
+                              "in activations (planned)" if in_offsets is not None else "separate, %d bytes" % in_size),
+              "outputs: %s" % ("in activations (ST Edge AI Core)" if "STAI_FLAG_OUTPUTS" in flags else
+                               "in activations (planned)" if out_offsets is not None else "separate, %d bytes" % out_size),
+              "states: %d bytes" % states_size,
+              "RAM allocated by init_network_buffers: %d bytes (%d bytes without planning)" % (planned, separate)]
+    return lines
+
+
+def main() -> int:
+    if len(sys.argv) != 2:
+        print(__doc__, file=sys.stderr)
+        return 1
+
+    hdr_path = os.path.join(sys.argv[1], "inc", "network.h")
+
+    try:
+        hdr, tensors, num_nodes = parse(sys.argv[1])
+        in_offsets, out_offsets, plan_size = plan(hdr, tensors)
+        lines = report(hdr, tensors, num_nodes, in_offsets, out_offsets, plan_size)
+
+        block = ["/*"] + [(" * " + line).rstrip() for line in lines] + [" */"]
+        if in_offsets is not None or out_offsets is not None:
+            block.append("#define STAI_NETWORK_PLAN_ACTIVATIONS_SIZE_BYTES (%d)" % plan_size)
+        if in_offsets is not None:
+            block.append("#define STAI_NETWORK_PLAN_IN_OFFSETS { %s }" % ", ".join(str(o) for o in in_offsets))
+        if out_offsets is not None:
+            block.append("#define STAI_NETWORK_PLAN_OUT_OFFSETS { %s }" % ", ".join(str(o) for o in out_offsets))
+
+        pos = hdr.rfind(HDR_INSERT)
+        if pos < 0:
+            raise ValueError("%s not found" % HDR_INSERT)
+        hdr = hdr[:pos] + BEGIN_MARK + "\n" + "\n".join(block) + "\n" + END_MARK + "\n\n" + hdr[pos:]
+    except (OSError, ValueError) as err:
+        print("%s: %s" % (sys.argv[1], err), file=sys.stderr)
+        return 1
+
+    with open(hdr_path, "w", encoding="utf-8", newline="\n") as f:
+        f.write(hdr)
+
+    print("\n".join(lines))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
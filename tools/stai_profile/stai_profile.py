@@ -0,0 +1,282 @@
+##############################################################################
+# Copyright(c) 2026 STMicroelectronics.
+# All rights reserved.
+#
+# This software is licensed under terms that can be found in the LICENSE file
+# in the root directory of this software component.
+# If no LICENSE file comes with this software, it is provided AS-IS.
+##############################################################################
+
+"""Report the cycles per MACC of each layer of the network generated by ST Edge AI Core for the ISPU.
+
+The time of each layer is read from the output of the profile command of the validation firmware
+(nucleo_ispu_stedgeai_validate), captured after a validation on target or read directly from the serial port (the
+mean time, if the inference was repeated with the repeat command of the firmware), or
+from the "Inference time per node" table of the validation report of ST Edge AI Core (network_validate_report.txt).
+The layers are in the order of the nodes listed in inc/network_details.h (the same node ids and types sent by the
+template to the firmware with get_nodes).
+
+The MACC of each node are estimated from the shapes of its tensors (inc/network_details.h) and the parameters of its
+kernel (src/network.c): output size times kernel size times input channels for the convolutions, output size times
+input channels for the dense layers, output size times pool size for the pooling layers, output size for the other
+layers. The report lists, for each node and for each type of layer, the time, the cycles of the ISPU, the MACC and
+the cycles per MACC. The cycles of each node can also be written as folded stacks (network;type;node cycles), which
+can be rendered as a flame graph by flamegraph.pl or speedscope.
+
+Usage:
+  python stai_profile.py [--port PORT [--baud 921600] | --input profile.txt | --report network_validate_report.txt
+                          [--clock HZ]] [--folded network.folded] path/to/ispu
+"""
+
+from typing import List, Optional, Tuple
+import argparse
+import os
+import re
+import sys
+
+TENSOR_RE = re.compile(r"\{ \.size_bytes = \d+,.*?\.shape = \{\d+, \(const int32_t\[\d+\]\)\{([\d, ]*)\}\},.*?"
+                       r"\.name = \"(\w+)\" \}")
+NODE_RE = re.compile(r"\{\.id = (\d+), \.type = AI_LAYER_(\w+)_TYPE, "
+                     r"\.input_tensors = \{\d+, \(const int32_t\[\d+\]\)\{([\d, ]+)\}\}, "
+                     r"\.output_tensors = \{\d+, \(const int32_t\[\d+\]\)\{([\d, ]+)\}\} \},? /\* (\w+) \*/")
+SECTION_RE = re.compile(r"/\* LITE_KERNEL_SECTION BEGIN (\w+) \*/\n(.*?)/\* LITE_KERNEL_SECTION END \1 \*/", re.DOTALL)
+
+# groups of layer types reported together
+GROUPS = {
+    "CONV2D": "conv", "OPTIMIZED_CONV2D": "conv", "CONV2D_DQNN": "conv",
+    "DENSE": "dense", "GEMM": "dense", "MATMUL": "dense", "DENSE_DQNN": "dense",
+    "POOL": "pool", "POOL_DQNN": "pool",
+    "SM": "softmax",
+    "NL": "nl",
+}
+
+# clock frequencies of the ISPU, to which the one computed from the validation report is rounded
+CLOCKS = [5000000, 10000000, 40000000]
+
+
+class Node:
+    def __init__(self, idx: int, node_id: int, layer_type: str, name: str) -> None:
+        self.idx = idx
+        self.id = node_id
+        self.type = layer_type
+        self.group = GROUPS.get(layer_type, layer_type.lower())
+        self.name = name
+        self.macc = None  # type: Optional[int]
+        self.time = 0.0  # [us]
+        self.cycles = 0
+
+
+def const(code: str, suffix: str) -> Optional[int]:
+    match = re.search(r"_%s_const_[us]\d+ = (\d+);" % suffix, code)
+    return int(match.group(1)) if match is not None else None
+
+
+def estimate_macc(src: str, node: Node, code: str, ins: List[List[int]], outs: List[List[int]]) -> Optional[int]:
+    def size(shape: List[int]) -> int:
+        total = 1
+        for dim in shape:
+            total *= dim
+        return total
+
+    out_size = sum(size(shape) for shape in outs)
+    in_ch = ins[0][-1] if ins and ins[0] else 1
+
+    if node.group == "conv":
+        kernel_w = const(code, "t_weight_0_shape_w")
+        kernel_h = const(code, "t_weight_0_shape_h")
+        if kernel_w is None or kernel_h is None:
+            return None
+        if re.search(r"forward_lite_\w*dw\w*\(", code) is None:  # not depthwise
+            in_ch = const(code, "t_in_0_shape_ch") or in_ch
+        else:
+            in_ch = 1
+        return out_size * kernel_w * kernel_h * in_ch
+
+    if node.group == "dense":
+        # the input may be flattened by the kernel (n_channel_in larger than the last dimension)
+        match = re.search(r"\.n_channel_in = (\d+),", code)
+        if match is not None:
+            in_ch = int(match.group(1))
+        else:
+            in_ch = const(code, "t_in_0_shape_ch") or in_ch
+        return out_size * in_ch
+
+    if node.group == "pool":
+        layer = re.search(r"AI_LAYER_OBJ_DECLARE\(\n  %s_layer,.*?\n\)" % node.name, src, re.DOTALL)
+        pool = re.search(r"\.pool_size = AI_SHAPE_2D_INIT\((\d+), (\d+)\)", layer.group(0)) if layer else None
+        if pool is not None:
+            return out_size * int(pool.group(1)) * int(pool.group(2))
+
+    return out_size
+
+
+def parse(ispu: str) -> Tuple[List[Node], Optional[int]]:
+    with open(os.path.join(ispu, "inc", "network.h"), "r", encoding="utf-8") as f:
+        hdr = f.read()
+    with open(os.path.join(ispu, "inc", "network_details.h"), "r", encoding="utf-8") as f:
+        details = f.read()
+    with open(os.path.join(ispu, "src", "network.c"), "r", encoding="utf-8") as f:
+        src = f.read()
+
+    shapes = [[int(d) for d in m.group(1).split(",") if d.strip()] for m in TENSOR_RE.finditer(details)]
+    sections = dict((m.group(1), m.group(2)) for m in SECTION_RE.finditer(src))
+
+    nodes = []
+    for idx, m in enumerate(NODE_RE.finditer(details)):
+        node = Node(idx, int(m.group(1)), m.group(2), m.group(5))
+        if node.name not in sections:
+            raise ValueError("node %s not found in network.c" % node.name)
+        ins = [shapes[int(t)] for t in m.group(3).split(",")]
+        outs = [shapes[int(t)] for t in m.group(4).split(",")]
+        node.macc = estimate_macc(src, node, sections[node.name], ins, outs)
+        nodes.append(node)
+
+    if not nodes:
+        raise ValueError("no nodes found in network_details.h")
+
+    macc = re.search(r"#define STAI_NETWORK_MACC_NUM\s+\((\d+)\)", hdr)
+    return nodes, int(macc.group(1)) if macc is not None else None
+
+
+def read_profile(text: str) -> Tuple[List[float], Optional[float], Optional[List[int]]]:
+    """Return the time of each layer [us], the clock [Hz] and the node ids (if known) from the profile text."""
+    clock = re.search(r"ISPU clock: (\d+) Hz", text)
+    if clock is not None:
+        # layer, min, mean, max, cycles
+        times = [float(m.group(1)) for m in re.finditer(r"^\d+\t\d+\t(\d+)\t\d+\t\d+\s*$", text, re.MULTILINE)]
+        lost = re.search(r"layer times lost: (\d+)", text)
+        if lost is not None and int(lost.group(1)) > 0:
+            raise ValueError("%s layer times lost by the firmware" % lost.group(1))
+        return times, float(clock.group(1)), None
+
+    table = text.find("Inference time per node")
+    if table < 0:
+        raise ValueError("no profile or inference time per node found")
+
+    times, ids = [], []
+    for m in re.finditer(r"^\s*\d+\s+(\d+)\s+.*?\s([\d.]+)\s+[\d.]+%\s+[\d.]+%\s+\S+\s*$", text[table:], re.MULTILINE):
+        ids.append(int(m.group(1)))
+        times.append(float(m.group(2)) * 1000)
+
+    # the clock follows from the cycles per MACC, the MACC and the duration of the inference
+    duration = re.search(r"duration\s*:\s*([\d.]+) ms", text)
+    macc = re.search(r"macc\s*:\s*(\d+)", text)
+    cycles_per_macc = re.search(r"cycles/MACC\s*:\s*([\d.]+)", text)
+    freq = None
+    if duration is not None and macc is not None and cycles_per_macc is not None:
+        freq = float(cycles_per_macc.group(1)) * int(macc.group(1)) / (float(duration.group(1)) / 1000)
+        freq = min(CLOCKS, key=lambda c: abs(c - freq))
+
+    return times, freq, ids
+
+
+def read_serial(port: str, baud: int) -> str:
+    import serial  # only needed to read from a serial port
+
+    with serial.Serial(port, baud, timeout=2) as ser:
+        ser.write(b"profile\n")
+        lines = []
+        while True:
+            line = ser.readline().decode("ascii", "replace")
+            if not line:
+                raise ValueError("no answer to the profile command")
+            lines.append(line)
+            if line.startswith("total"):
+                return "".join(lines)
+
+
+def report(nodes: List[Node], total_macc: Optional[int]) -> List[str]:
+    def ratio(cycles: float, macc: Optional[int]) -> str:
+        return "%.2f" % (cycles / macc) if macc else "-"
+
+    total_time = sum(n.time for n in nodes) or 1.0
+
+    lines = ["%-32s %-10s %10s %7s %10s %10s %12s" %
+             ("node", "type", "time [us]", "%", "cycles", "MACC", "cycles/MACC")]
+    for n in nodes:
+        lines.append("%-32s %-10s %10.0f %6.2f%% %10d %10s %12s" %
+                     (n.name, n.group, n.time, 100 * n.time / total_time, n.cycles,
+                      "-" if n.macc is None else str(n.macc), ratio(n.cycles, n.macc)))
+
+    groups = []  # type: List[str]
+    for n in nodes:
+        if n.group not in groups:
+            groups.append(n.group)
+
+    lines += ["", "%-32s %-10s %10s %7s %10s %10s %12s" %
+              ("type", "nodes", "time [us]", "%", "cycles", "MACC", "cycles/MACC")]
+    for group in sorted(groups, key=lambda g: -sum(n.time for n in nodes if n.group == g)):
+        members = [n for n in nodes if n.group == group]
+        time = sum(n.time for n in members)
+        cycles = sum(n.cycles for n in members)
+        # the nodes whose MACC are not known are not included in the cycles per MACC
+        known = [n for n in members if n.macc is not None]
+        macc = sum(n.macc for n in known)
+        lines.append("%-32s %-10d %10.0f %6.2f%% %10d %10s %12s" %
+                     (group, len(members), time, 100 * time / total_time, cycles, str(macc) if known else "-",
+                      ratio(sum(n.cycles for n in known), macc)))
+
+    cycles = sum(n.cycles for n in nodes)
+    macc = sum(n.macc for n in nodes if n.macc is not None)
+    lines += ["", "%-32s %-10d %10.0f %7s %10d %10d %12s" %
+              ("total", len(nodes), sum(n.time for n in nodes), "", cycles, macc, ratio(cycles, macc))]
+    if total_macc is not None:
+        lines.append("estimated MACC: %d (STAI_NETWORK_MACC_NUM: %d)" % (macc, total_macc))
+    return lines
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[0])
+    parser.add_argument("ispu", help="ispu folder of the project, containing the generated network")
+    parser.add_argument("--port", help="serial port of the Nucleo board running the validation firmware")
+    parser.add_argument("--baud", type=int, default=921600, help="baud rate of the serial port")
+    parser.add_argument("--input", help="output of the profile command of the validation firmware")
+    parser.add_argument("--report", help="validation report of ST Edge AI Core (network_validate_report.txt)")
+    parser.add_argument("--clock", type=int, help="clock frequency of the ISPU [Hz], if not in the input")
+    parser.add_argument("--folded", help="output file of the cycles of each node as folded stacks (flame graph)")
+    args = parser.parse_args()
+
+    sources = [s for s in (args.port, args.input, args.report) if s is not None]
+    if len(sources) != 1:
+        print("%s: specify one of --port, --input or --report" % args.ispu, file=sys.stderr)
+        return 1
+
+    try:
+        nodes, total_macc = parse(args.ispu)
+
+        if args.port is not None:
+            text = read_serial(args.port, args.baud)
+        else:
+            with open(sources[0], "r", encoding="utf-8", errors="replace") as f:
+                text = f.read()
+        times, freq, ids = read_profile(text)
+
+        if args.clock is not None:
+            freq = args.clock
+        if freq is None:
+            raise ValueError("clock frequency of the ISPU not found, specify it with --clock")
+        if len(times) != len(nodes):
+            raise ValueError("%d layer times for %d nodes" % (len(times), len(nodes)))
+        if ids is not None and ids != [n.id for n in nodes]:
+            raise ValueError("the nodes of the profile do not match the ones of network_details.h")
+    except (OSError, ValueError) as err:
+        print("%s: %s" % (sources[0] if sources else args.ispu, err), file=sys.stderr)
+        return 1
+
+    for node, time in zip(nodes, times):
+        node.time = time
+        node.cycles = int(round(time * freq / 1000000))
+
+    print("ISPU clock: %d Hz" % freq)
+    print("\n".join(report(nodes, total_macc)))
+
+    if args.folded is not None:
+        with open(args.folded, "w", encoding="utf-8", newline="\n") as f:
+            for n in nodes:
+                f.write("network;%s;%s %d\n" % (n.group, n.name, n.cycles))
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
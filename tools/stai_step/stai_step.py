@@ -0,0 +1,177 @@
+##############################################################################
+# Copyright(c) 2026 STMicroelectronics.
+# All rights reserved.
+#
+# This software is licensed under terms that can be found in the LICENSE file
+# in the root directory of this software component.
+# If no LICENSE file comes with this software, it is provided AS-IS.
+##############################################################################
+
+"""Add the execution of a range of nodes to the network generated by ST Edge AI Core for the ISPU.
+
+The generated stai_network_run function executes all the nodes of the network, one LITE_KERNEL_SECTION block per node.
+This script adds to src/network.c (before the private macros are undefined) the function
+
+  stai_return_code stai_network_run_nodes(stai_network* network, const stai_size first, const stai_size n_nodes)
+
+executing only the nodes from first to first + n_nodes - 1 (in the same order, with the same code), so that an
+inference can be spread over several calls, and adds its declaration and the STAI_NETWORK_RUN_NODES symbol, which
+enables run_network_step in network_utils.c, to inc/network.h.
+
+The files are modified in place and can be processed again after being regenerated (the code previously added is
+replaced).
+
+Usage:
+  python stai_step.py path/to/ispu
+"""
+
+from typing import List, Tuple
+import os
+import re
+import sys
+
+BEGIN_MARK = "/* STAI_STEP BEGIN (added by stai_step.py, do not edit) */"
+END_MARK = "/* STAI_STEP END */"
+
+# the private macros used by the generated code are undefined at the end of network.c
+SRC_INSERT = "#undef _STAI_SET_ERROR"
+HDR_INSERT = "STAI_API_DECLARE_END"
+
+RUN_RE = re.compile(r"STAI_API_ENTRY\s*\nstai_return_code stai_network_run\(\s*\n"
+                    r"\s*stai_network\* network,\s*\n\s*const stai_run_mode mode\)\s*\n\{\n")
+SECTION_RE = re.compile(r"[ \t]*/\* LITE_KERNEL_SECTION BEGIN (\w+) \*/\n(.*?)[ \t]*/\* LITE_KERNEL_SECTION END \1 \*/\n?",
+                        re.DOTALL)
+
+DECLARATION = """\
+/**
+ * @brief Run a range of nodes of the network.
+ * @details the nodes are executed in the same order as @ref stai_network_run(), so that calling this API for
+ *          consecutive ranges covering all the nodes (STAI_NETWORK_NODES_NUM) gives the same result.
+ * @param[in] network network context opaque pointer
+ * @param[in] first index of the first node to run
+ * @param[in] n_nodes number of nodes to run
+ * @return STAI_SUCCESS on correct run, else error 1st return code from @ref stai_return_code enums.
+ */
+#define STAI_NETWORK_RUN_NODES
+
+STAI_API_ENTRY
+stai_return_code stai_network_run_nodes(
+  stai_network* network,
+  const stai_size first,
+  const stai_size n_nodes);
+"""
+
+
+def strip_previous(src: str) -> str:
+    begin = src.find(BEGIN_MARK)
+    if begin < 0:
+        return src
+    end = src.index(END_MARK, begin) + len(END_MARK)
+    return src[:begin] + src[end:].lstrip("\n")
+
+
+def insert_block(src: str, mark: str, block: str) -> str:
+    pos = src.rfind(mark)
+    if pos < 0:
+        raise ValueError("%s not found" % mark)
+    return src[:pos] + BEGIN_MARK + "\n" + block + END_MARK + "\n\n" + src[pos:]
+
+
+def parse_run(src: str) -> Tuple[str, List[Tuple[str, str]]]:
+    """Return the checks at the beginning of stai_network_run and its sections (name, code)."""
+    match = RUN_RE.search(src)
+    if match is None:
+        raise ValueError("stai_network_run not found")
+
+    body_start = match.end()
+    body_end = src.index("\n  return net_ctx->_return_code;\n}", body_start)
+    body = src[body_start:body_end]
+
+    first = SECTION_RE.search(body)
+    if first is None:
+        raise ValueError("no LITE_KERNEL_SECTION found in stai_network_run")
+
+    checks = body[:first.start()].replace("   STAI_UNUSED(mode)\n", "")
+    sections = [(m.group(1), m.group(2)) for m in SECTION_RE.finditer(body)]
+
+    # anything other than the sections after the checks would be skipped by the stepped execution
+    rest = SECTION_RE.sub("", body[first.start():]).strip()
+    if rest:
+        raise ValueError("unexpected code between the LITE_KERNEL_SECTION blocks of stai_network_run")
+
+    return checks, sections
+
+
+def make_run_nodes(checks: str, sections: List[Tuple[str, str]]) -> str:
+    out = ["STAI_API_ENTRY",
+           "stai_return_code stai_network_run_nodes(",
+           "  stai_network* network,",
+           "  const stai_size first,",
+           "  const stai_size n_nodes)",
+           "{",
+           checks.rstrip("\n"),
+           "",
+           "  for (stai_size node = first; (node < (first + n_nodes)) && (node < %d); node++) {" % len(sections),
+           "    switch (node) {"]
+
+    for idx, (name, code) in enumerate(sections):
+        out.append("    case %d: /* %s */" % (idx, name))
+        out.append(code.rstrip("\n"))
+        out.append("    break;")
+
+    out += ["    default:",
+            "    break;",
+            "    }",
+            "  }",
+            "",
+            "  return net_ctx->_return_code;",
+            "}",
+            ""]
+
+    return "\n".join(out)
+
+
+def read(path: str) -> str:
+    with open(path, "r", encoding="utf-8") as f:
+        return strip_previous(f.read())
+
+
+def write(path: str, src: str) -> None:
+    with open(path, "w", encoding="utf-8", newline="\n") as f:
+        f.write(src)
+
+
+def main() -> int:
+    if len(sys.argv) != 2:
+        print(__doc__, file=sys.stderr)
+        return 1
+
+    src_path = os.path.join(sys.argv[1], "src", "network.c")
+    hdr_path = os.path.join(sys.argv[1], "inc", "network.h")
+
+    try:
+        src = read(src_path)
+        hdr = read(hdr_path)
+
+        checks, sections = parse_run(src)
+
+        # the callers step through STAI_NETWORK_NODES_NUM nodes
+        nodes = re.search(r"#define STAI_NETWORK_NODES_NUM\s+\((\d+)\)", hdr)
+        if nodes is None or int(nodes.group(1)) != len(sections):
+            raise ValueError("STAI_NETWORK_NODES_NUM does not match the %d nodes of stai_network_run" % len(sections))
+
+        src = insert_block(src, SRC_INSERT, make_run_nodes(checks, sections))
+        hdr = insert_block(hdr, HDR_INSERT, DECLARATION)
+    except (OSError, ValueError) as err:
+        print("%s: %s" % (sys.argv[1], err), file=sys.stderr)
+        return 1
+
+    write(src_path, src)
+    write(hdr_path, hdr)
+
+    print("%s: %d nodes" % (src_path, len(sections)))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -446,6 +446,50 @@ stai_return_code stai_network_set_callback(
 
 
 
+/* STAI_STEP BEGIN (added by stai_step.py, do not edit) */
+/**
+ * @brief Run a range of nodes of the network.
+ * @details the nodes are executed in the same order as @ref stai_network_run(), so that calling this API for
+ *          consecutive ranges covering all the nodes (STAI_NETWORK_NODES_NUM) gives the same result.
+ * @param[in] network network context opaque pointer
+ * @param[in] first index of the first node to run
+ * @param[in] n_nodes number of nodes to run
+ * @return STAI_SUCCESS on correct run, else error 1st return code from @ref stai_return_code enums.
+ */
+#define STAI_NETWORK_RUN_NODES
+
+STAI_API_ENTRY
+stai_return_code stai_network_run_nodes(
+  stai_network* network,
+  const stai_size first,
+  const stai_size n_nodes);
+/* STAI_STEP END */
+
+/* STAI_PLAN BEGIN (added by stai_plan.py, do not edit) */
+/*
+ * tensor                              bytes  location                 lifetime (nodes)
+ * input_output                          624  activations[0] 1156-1779 before-0
+ * conv_hidden_0_output                 1664  activations[0] 0-1663    0-1
+ * activation_3_output                  1664  activations[0] 0-1663    1-2
+ * max_pooling1d_3_output                832  activations[0] 0-831     2-3
+ * conv_hidden_1_output                  832  activations[0] 832-1663  3-4
+ * activation_4_output                   832  activations[0] 0-831     4-5
+ * max_pooling1d_4_output                416  activations[0] 832-1247  5-6
+ * conv_hidden_2_output                  416  activations[0] 0-415     6-7
+ * activation_5_output                   416  activations[0] 416-831   7-8
+ * max_pooling1d_5_output                192  activations[0] 0-191     8-9
+ * dense_out_output                       16  activations[0] 192-207   9-10
+ * output_output                          16  activations[0] 0-15      10-after
+ *
+ * activations in use (peak): 1780 bytes at node 0
+ * activations buffer: 1780 bytes
+ * inputs: in activations (ST Edge AI Core)
+ * outputs: in activations (ST Edge AI Core)
+ * states: 0 bytes
+ * RAM allocated by init_network_buffers: 1780 bytes (1780 bytes without planning)
+ */
+/* STAI_PLAN END */
+
 STAI_API_DECLARE_END
 
 #endif    /* STAI_NETWORK_H */
@@ -0,0 +1,65 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#ifndef STREAM_CNN_H
+#define STREAM_CNN_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define STREAM_CNN_MAX_LAYERS 8
+
+// 1-D convolution with stride 1, followed by ReLU, optional batch normalization, and max pooling
+struct stream_cnn_layer {
+	const float *weights;   // [out_ch][kernel][in_ch], as generated by ST Edge AI Core
+	const float *bias;      // [out_ch]
+	const float *bn_scale;  // [out_ch], NULL if not followed by batch normalization
+	const float *bn_offset; // [out_ch]
+	uint8_t in_ch;
+	uint8_t out_ch;
+	uint8_t kernel;
+	uint8_t pool;           // max pooling size, 1 if not followed by max pooling
+	float *buf;             // kernel * in_ch + out_ch values, last input frames and pooling
+};
+
+// dense layer on the last frames of the last convolutional layer (flattened), followed by softmax
+struct stream_cnn_dense {
+	const float *weights;   // [out][frames * ch]
+	const float *bias;      // [out]
+	uint16_t frames;
+	uint8_t ch;
+	uint8_t out;
+	float *buf;             // frames * ch values, last frames
+};
+
+struct stream_cnn {
+	const struct stream_cnn_layer *layers;
+	const struct stream_cnn_dense *dense;
+	uint8_t num_layers;
+	uint8_t pos[STREAM_CNN_MAX_LAYERS];
+	uint8_t cnt[STREAM_CNN_MAX_LAYERS];
+	uint16_t dense_pos;
+	uint16_t dense_cnt;
+};
+
+// the past input frames are zero at the beginning, as the zero padding of a window
+void stream_cnn_init(struct stream_cnn *cnn, const struct stream_cnn_layer *layers, uint8_t num_layers,
+		const struct stream_cnn_dense *dense);
+
+// computes only the new output frame of each layer, returns true when the output (dense->out probabilities) is
+// updated, that is, every product of the pooling sizes samples once dense->frames frames are available
+bool stream_cnn_run(struct stream_cnn *cnn, const float *sample, float *output);
+
+#endif
+
@@ -21,9 +21,31 @@
 #include "stai.h"
 #include "network.h"
 #include "network_utils.h"
+#include "network_data.h"
+#include "stream_cnn.h"
 
 #define ACC_SENS 0.244f // [mg/LSB]
 
+// samples between two consecutive windows (a prediction every WIN_HOP samples, on windows overlapping by
+// STAI_NETWORK_IN_1_HEIGHT - WIN_HOP samples)
+#define WIN_HOP 26u
+
+// maximum number of network nodes run at each sample (the inference is spread over several samples)
+#define NODES_PER_SAMPLE 1u
+
+// set to 1 to run the convolutional layers incrementally at each sample instead of running the whole network on each
+// window (a prediction every 8 samples, the product of the pooling sizes, computing only the new time steps)
+#define STREAMING 0
+
+#if WIN_HOP == 0u || WIN_HOP > STAI_NETWORK_IN_1_HEIGHT
+#error "WIN_HOP must be between 1 and the window length"
+#endif
+
+// the inference must be complete before the next window is
+#if ((STAI_NETWORK_NODES_NUM + NODES_PER_SAMPLE - 1u) / NODES_PER_SAMPLE) > WIN_HOP
+#error "NODES_PER_SAMPLE too low for the window hop"
+#endif
+
 void __attribute__ ((signal)) algo_00_init(void);
 void __attribute__ ((signal)) algo_00(void);
 
@@ -34,7 +56,51 @@ static stai_ptr output_buffers[STAI_NETWORK_OUT_NUM];
 
 static volatile uint32_t int_status;
 
-static uint8_t win_cnt;
+// sliding acquisition window, copied to the input buffer when complete, so that the acquisition of the next window
+// can continue while the inference runs
+static float window_buf[STAI_NETWORK_IN_1_HEIGHT][STAI_NETWORK_IN_1_CHANNEL];
+static struct input_window window;
+
+// next node to run, STAI_NETWORK_NODES_NUM when no inference is running
+static stai_size node;
+
+#if STREAMING
+// weights of the network generated by ST Edge AI Core, the offsets (in bytes) are the ones used in network.c
+#define WEIGHTS(offset) (&((const float *)g_network_weights_array)[(offset) / sizeof(float)])
+
+static float conv_0_buf[3 * 3 + 8];
+static float conv_1_buf[3 * 8 + 8];
+static float conv_2_buf[3 * 8 + 8];
+static float dense_buf[6 * 8];
+
+static const struct stream_cnn_layer stream_layers[] = {
+	{ WEIGHTS(0), WEIGHTS(288), NULL, NULL, 3, 8, 3, 2, conv_0_buf },
+	{ WEIGHTS(320), WEIGHTS(1088), NULL, NULL, 8, 8, 3, 2, conv_1_buf },
+	{ WEIGHTS(1120), WEIGHTS(1888), NULL, NULL, 8, 8, 3, 2, conv_2_buf },
+};
+
+static const struct stream_cnn_dense stream_dense = { WEIGHTS(1920), WEIGHTS(2688), 6, 8, 4, dense_buf };
+
+static struct stream_cnn stream;
+#endif
+
+static void write_results(void *out_addr, const float *prob)
+{
+	// prediction corresponds to the output with the highest probability
+	uint8_t prediction = 0;
+	float max_prob = -1.0f;
+	for (uint8_t i = 0; i < STAI_NETWORK_OUT_1_CHANNEL; i++) {
+		if (prob[i] > max_prob) {
+			max_prob = prob[i];
+			prediction = i;
+		}
+	}
+
+	// write prediction results to output registers
+	for (uint8_t i = 0; i < STAI_NETWORK_OUT_1_CHANNEL; i++, out_addr += sizeof(float))
+		cast_float(out_addr) = prob[i];
+	cast_uint8_t(out_addr) = prediction;
+}
 
 void __attribute__ ((signal)) algo_00_init(void)
 {
@@ -44,7 +110,12 @@ void __attribute__ ((signal)) algo_00_init(void)
 	init_network_buffers(net, input_buffers, output_buffers);
 
 	// initialize state variables
-	win_cnt = 0;
+	init_input_window(&window, &window_buf[0][0], STAI_NETWORK_IN_1_HEIGHT, STAI_NETWORK_IN_1_CHANNEL, WIN_HOP);
+	node = STAI_NETWORK_NODES_NUM;
+
+#if STREAMING
+	stream_cnn_init(&stream, stream_layers, sizeof(stream_layers) / sizeof(stream_layers[0]), &stream_dense);
+#endif
 }
 
 void __attribute__ ((signal)) algo_00(void)
@@ -52,45 +123,44 @@ void __attribute__ ((signal)) algo_00(void)
 	// ispu output registers base address
 	void *out_addr = (void *)ISPU_DOUT_00;
 
-	// reinterpret input buffer as a multi-dimensional array of shape {1,52,3}
-	float (*input)[STAI_NETWORK_IN_1_HEIGHT][STAI_NETWORK_IN_1_CHANNEL] =
-		(float (*)[STAI_NETWORK_IN_1_HEIGHT][STAI_NETWORK_IN_1_CHANNEL])input_buffers[0];
-
-	// reinterpret output buffer as a multi-dimensional array of shape {1,4}
-	float (*output)[STAI_NETWORK_OUT_1_CHANNEL] =
-		(float (*)[STAI_NETWORK_OUT_1_CHANNEL])output_buffers[0];
-
-	// read accelerometer data and place it inside input buffer
-	input[0][win_cnt][0] = cast_sint16_t(ISPU_ARAW_X) * ACC_SENS;
-	input[0][win_cnt][1] = cast_sint16_t(ISPU_ARAW_Y) * ACC_SENS;
-	input[0][win_cnt][2] = cast_sint16_t(ISPU_ARAW_Z) * ACC_SENS;
+	// read accelerometer data
+	float sample[STAI_NETWORK_IN_1_CHANNEL];
+	sample[0] = cast_sint16_t(ISPU_ARAW_X) * ACC_SENS;
+	sample[1] = cast_sint16_t(ISPU_ARAW_Y) * ACC_SENS;
+	sample[2] = cast_sint16_t(ISPU_ARAW_Z) * ACC_SENS;
 
 	// write accelerometer data to output registers
 	for (uint8_t i = 0; i < STAI_NETWORK_IN_1_CHANNEL; i++, out_addr += sizeof(float))
-		cast_float(out_addr) = input[0][win_cnt][i];
-
-	// increment count and check if input buffer is ready
-	if (++win_cnt == STAI_NETWORK_IN_1_HEIGHT) {
-		win_cnt = 0;
-
-		// run model inference
-		stai_network_run(net, STAI_MODE_SYNC);
-
-		// prediction corresponds to the output with the highest probability
-		uint8_t prediction = 0;
-		float max_prob = -1.0f;
-		for (uint8_t i = 0; i < STAI_NETWORK_OUT_1_CHANNEL; i++) {
-			if (output[0][i] > max_prob) {
-				max_prob = output[0][i];
-				prediction = i;
-			}
-		}
+		cast_float(out_addr) = sample[i];
 
-		// write prediction results to output registers
-		for (uint8_t i = 0; i < STAI_NETWORK_OUT_1_CHANNEL; i++, out_addr += sizeof(float))
-			cast_float(out_addr) = output[0][i];
-		cast_uint8_t(out_addr) = prediction;
+#if STREAMING
+	// run the new time steps of each layer, the outputs are updated every 8 samples
+	float prob[STAI_NETWORK_OUT_1_CHANNEL];
+	if (stream_cnn_run(&stream, sample, prob)) {
+		write_results(out_addr, prob);
+	}
+#else
+	// place accelerometer data inside acquisition window and check if a new window is complete
+	if (push_input_window(&window, sample)) {
+		// start model inference on the complete window
+		copy_input_window(&window, input_buffers[0]);
+		node = 0;
+	}
+
+	// run the next nodes of the model inference, if running
+	if (node < STAI_NETWORK_NODES_NUM) {
+		stai_return_code res = run_network_step(net, &node, NODES_PER_SAMPLE);
+
+		// check if model inference is complete
+		if (node == STAI_NETWORK_NODES_NUM && res == STAI_SUCCESS) {
+			// reinterpret output buffer as a multi-dimensional array of shape {1,4}
+			float (*output)[STAI_NETWORK_OUT_1_CHANNEL] =
+				(float (*)[STAI_NETWORK_OUT_1_CHANNEL])output_buffers[0];
+
+			write_results(out_addr, output[0]);
+		}
 	}
+#endif
 
 	// interrupt generation
 	int_status = int_status | 0x1u;
@@ -946,6 +946,213 @@ stai_return_code stai_network_set_callback(
   return net_ctx->_return_code;
 }
 
+/* STAI_STEP BEGIN (added by stai_step.py, do not edit) */
+STAI_API_ENTRY
+stai_return_code stai_network_run_nodes(
+  stai_network* network,
+  const stai_size first,
+  const stai_size n_nodes)
+{
+  _STAI_CONTEXT_ACQUIRE(net_ctx, network)
+
+  _STAI_SET_ERROR(net_ctx, (net_ctx->_flags & STAI_FLAG_ACTIVATIONS) != STAI_FLAG_ACTIVATIONS,
+        STAI_ERROR_NETWORK_INVALID_ACTIVATIONS_PTR, net_ctx->_return_code)
+
+  _STAI_SET_ERROR(net_ctx, (net_ctx->_flags & STAI_FLAG_INPUTS) != STAI_FLAG_INPUTS,
+                  STAI_ERROR_NETWORK_INVALID_IN_PTR, net_ctx->_return_code)
+  _STAI_SET_ERROR(net_ctx, (net_ctx->_flags & STAI_FLAG_OUTPUTS) != STAI_FLAG_OUTPUTS,
+                  STAI_ERROR_NETWORK_INVALID_OUT_PTR, net_ctx->_return_code)
+
+  _STAI_SET_ERROR(net_ctx, (net_ctx->_flags & STAI_FLAG_WEIGHTS) != STAI_FLAG_WEIGHTS,
+                  STAI_ERROR_NETWORK_INVALID_WEIGHTS_PTR, net_ctx->_return_code)
+
+  for (stai_size node = first; (node < (first + n_nodes)) && (node < 11); node++) {
+    switch (node) {
+    case 0: /* conv_hidden_0 */
+  {
+      const ai_float* conv_hidden_0_t_in_0_ptr_const_f32 = (ai_float*)(net_ctx->_inputs[0] + 0);
+    ai_float* conv_hidden_0_t_out_0_ptr_f32 = (ai_float*)(net_ctx->_activations[0] + 0);
+    const ai_u8* conv_hidden_0_t_weight_0_ptr_const_u8 = (ai_u8*)(net_ctx->_weights[0] + 0);
+    const ai_u8* conv_hidden_0_t_weight_1_ptr_const_u8 = (ai_u8*)(net_ctx->_weights[0] + 288);
+    ai_float* conv_hidden_0_t_scratch_0_ptr_f32 = (ai_float*)(NULL);
+    const ai_u32 conv_hidden_0_t_in_0_shape_ch_const_u32 = 3;
+    const ai_u32 conv_hidden_0_t_out_0_shape_ch_const_u32 = 8;
+    const ai_u32 conv_hidden_0_t_in_0_shape_w_const_u32 = 1;
+    const ai_u32 conv_hidden_0_t_in_0_shape_h_const_u32 = 52;
+    const ai_u32 conv_hidden_0_t_out_0_shape_w_const_u32 = 1;
+    const ai_u32 conv_hidden_0_t_out_0_shape_h_const_u32 = 52;
+    const ai_u32 conv_hidden_0_t_weight_0_shape_w_const_u32 = 1;
+    const ai_u32 conv_hidden_0_t_weight_0_shape_h_const_u32 = 3;
+    const ai_i32 conv_hidden_0_l_pad_W_0_const_s32 = 0;
+    const ai_i32 conv_hidden_0_l_pad_H_0_const_s32 = 1;
+    const ai_u16 conv_hidden_0_l_stride_1_const_u16 = 1;
+    const ai_u16 conv_hidden_0_l_stride_0_const_u16 = 1;
+    const ai_u16 conv_hidden_0_l_dilation_H_const_u16 = 1;
+    const ai_u16 conv_hidden_0_l_dilation_W_const_u16 = 1;
+  
+  _STAI_NETWORK_EVENT_NODE_START_CB(2, 1, {(stai_ptr) conv_hidden_0_t_in_0_ptr_const_f32});
+    
+  forward_lite_conv2d_if32of32wf32(conv_hidden_0_t_in_0_ptr_const_f32, conv_hidden_0_t_out_0_ptr_f32, conv_hidden_0_t_weight_0_ptr_const_u8, conv_hidden_0_t_weight_1_ptr_const_u8, conv_hidden_0_t_scratch_0_ptr_f32, conv_hidden_0_t_in_0_shape_ch_const_u32, conv_hidden_0_t_out_0_shape_ch_const_u32, conv_hidden_0_t_in_0_shape_w_const_u32, conv_hidden_0_t_in_0_shape_h_const_u32, conv_hidden_0_t_out_0_shape_w_const_u32, conv_hidden_0_t_out_0_shape_h_const_u32, conv_hidden_0_t_weight_0_shape_w_const_u32, conv_hidden_0_t_weight_0_shape_h_const_u32, conv_hidden_0_l_pad_W_0_const_s32, conv_hidden_0_l_pad_H_0_const_s32, conv_hidden_0_l_stride_1_const_u16, conv_hidden_0_l_stride_0_const_u16, 3, 1, conv_hidden_0_l_dilation_H_const_u16, conv_hidden_0_l_dilation_W_const_u16, (ai_size)(1));
+    
+  _STAI_NETWORK_EVENT_NODE_STOP_CB(2, 1, {(stai_ptr) conv_hidden_0_t_out_0_ptr_f32});
+  }
+    break;
+    case 1: /* activation_3 */
+  {
+      ai_handle activation_3_t_out_0_ptr_handle = (ai_handle)(net_ctx->_activations[0] + 0);
+    const ai_handle activation_3_t_in_0_ptr_const_handle = (ai_handle)(net_ctx->_activations[0] + 0);
+    const ai_i32 activation_3_t_in_0_shape_ch_h_prod_const_s32 = 416;
+  
+  _STAI_NETWORK_EVENT_NODE_START_CB(3, 1, {(stai_ptr) activation_3_t_in_0_ptr_const_handle});
+    
+  forward_lite_nl_relu_if32of32(activation_3_t_out_0_ptr_handle, activation_3_t_in_0_ptr_const_handle, activation_3_t_in_0_shape_ch_h_prod_const_s32, NULL);
+    
+  _STAI_NETWORK_EVENT_NODE_STOP_CB(3, 1, {(stai_ptr) activation_3_t_out_0_ptr_handle});
+  }
+    break;
+    case 2: /* max_pooling1d_3 */
+  {
+    
+  forward_lite_mp_max_pooling1d_3(net_ctx);
+  }
+    break;
+    case 3: /* conv_hidden_1 */
+  {
+      const ai_float* conv_hidden_1_t_in_0_ptr_const_f32 = (ai_float*)(net_ctx->_activations[0] + 0);
+    ai_float* conv_hidden_1_t_out_0_ptr_f32 = (ai_float*)(net_ctx->_activations[0] + 832);
+    const ai_u8* conv_hidden_1_t_weight_0_ptr_const_u8 = (ai_u8*)(net_ctx->_weights[0] + 320);
+    const ai_u8* conv_hidden_1_t_weight_1_ptr_const_u8 = (ai_u8*)(net_ctx->_weights[0] + 1088);
+    ai_float* conv_hidden_1_t_scratch_0_ptr_f32 = (ai_float*)(NULL);
+    const ai_u32 conv_hidden_1_t_in_0_shape_ch_const_u32 = 8;
+    const ai_u32 conv_hidden_1_t_out_0_shape_ch_const_u32 = 8;
+    const ai_u32 conv_hidden_1_t_in_0_shape_w_const_u32 = 1;
+    const ai_u32 conv_hidden_1_t_in_0_shape_h_const_u32 = 26;
+    const ai_u32 conv_hidden_1_t_out_0_shape_w_const_u32 = 1;
+    const ai_u32 conv_hidden_1_t_out_0_shape_h_const_u32 = 26;
+    const ai_u32 conv_hidden_1_t_weight_0_shape_w_const_u32 = 1;
+    const ai_u32 conv_hidden_1_t_weight_0_shape_h_const_u32 = 3;
+    const ai_i32 conv_hidden_1_l_pad_W_0_const_s32 = 0;
+    const ai_i32 conv_hidden_1_l_pad_H_0_const_s32 = 1;
+    const ai_u16 conv_hidden_1_l_stride_1_const_u16 = 1;
+    const ai_u16 conv_hidden_1_l_stride_0_const_u16 = 1;
+    const ai_u16 conv_hidden_1_l_dilation_H_const_u16 = 1;
+    const ai_u16 conv_hidden_1_l_dilation_W_const_u16 = 1;
+  
+  _STAI_NETWORK_EVENT_NODE_START_CB(6, 1, {(stai_ptr) conv_hidden_1_t_in_0_ptr_const_f32});
+    
+  forward_lite_conv2d_if32of32wf32(conv_hidden_1_t_in_0_ptr_const_f32, conv_hidden_1_t_out_0_ptr_f32, conv_hidden_1_t_weight_0_ptr_const_u8, conv_hidden_1_t_weight_1_ptr_const_u8, conv_hidden_1_t_scratch_0_ptr_f32, conv_hidden_1_t_in_0_shape_ch_const_u32, conv_hidden_1_t_out_0_shape_ch_const_u32, conv_hidden_1_t_in_0_shape_w_const_u32, conv_hidden_1_t_in_0_shape_h_const_u32, conv_hidden_1_t_out_0_shape_w_const_u32, conv_hidden_1_t_out_0_shape_h_const_u32, conv_hidden_1_t_weight_0_shape_w_const_u32, conv_hidden_1_t_weight_0_shape_h_const_u32, conv_hidden_1_l_pad_W_0_const_s32, conv_hidden_1_l_pad_H_0_const_s32, conv_hidden_1_l_stride_1_const_u16, conv_hidden_1_l_stride_0_const_u16, 3, 1, conv_hidden_1_l_dilation_H_const_u16, conv_hidden_1_l_dilation_W_const_u16, (ai_size)(1));
+    
+  _STAI_NETWORK_EVENT_NODE_STOP_CB(6, 1, {(stai_ptr) conv_hidden_1_t_out_0_ptr_f32});
+  }
+    break;
+    case 4: /* activation_4 */
+  {
+      ai_handle activation_4_t_out_0_ptr_handle = (ai_handle)(net_ctx->_activations[0] + 0);
+    const ai_handle activation_4_t_in_0_ptr_const_handle = (ai_handle)(net_ctx->_activations[0] + 832);
+    const ai_i32 activation_4_t_in_0_shape_ch_h_prod_const_s32 = 208;
+  
+  _STAI_NETWORK_EVENT_NODE_START_CB(7, 1, {(stai_ptr) activation_4_t_in_0_ptr_const_handle});
+    
+  forward_lite_nl_relu_if32of32(activation_4_t_out_0_ptr_handle, activation_4_t_in_0_ptr_const_handle, activation_4_t_in_0_shape_ch_h_prod_const_s32, NULL);
+    
+  _STAI_NETWORK_EVENT_NODE_STOP_CB(7, 1, {(stai_ptr) activation_4_t_out_0_ptr_handle});
+  }
+    break;
+    case 5: /* max_pooling1d_4 */
+  {
+    
+  forward_lite_mp_max_pooling1d_4(net_ctx);
+  }
+    break;
+    case 6: /* conv_hidden_2 */
+  {
+      const ai_float* conv_hidden_2_t_in_0_ptr_const_f32 = (ai_float*)(net_ctx->_activations[0] + 832);
+    ai_float* conv_hidden_2_t_out_0_ptr_f32 = (ai_float*)(net_ctx->_activations[0] + 0);
+    const ai_u8* conv_hidden_2_t_weight_0_ptr_const_u8 = (ai_u8*)(net_ctx->_weights[0] + 1120);
+    const ai_u8* conv_hidden_2_t_weight_1_ptr_const_u8 = (ai_u8*)(net_ctx->_weights[0] + 1888);
+    ai_float* conv_hidden_2_t_scratch_0_ptr_f32 = (ai_float*)(NULL);
+    const ai_u32 conv_hidden_2_t_in_0_shape_ch_const_u32 = 8;
+    const ai_u32 conv_hidden_2_t_out_0_shape_ch_const_u32 = 8;
+    const ai_u32 conv_hidden_2_t_in_0_shape_w_const_u32 = 1;
+    const ai_u32 conv_hidden_2_t_in_0_shape_h_const_u32 = 13;
+    const ai_u32 conv_hidden_2_t_out_0_shape_w_const_u32 = 1;
+    const ai_u32 conv_hidden_2_t_out_0_shape_h_const_u32 = 13;
+    const ai_u32 conv_hidden_2_t_weight_0_shape_w_const_u32 = 1;
+    const ai_u32 conv_hidden_2_t_weight_0_shape_h_const_u32 = 3;
+    const ai_i32 conv_hidden_2_l_pad_W_0_const_s32 = 0;
+    const ai_i32 conv_hidden_2_l_pad_H_0_const_s32 = 1;
+    const ai_u16 conv_hidden_2_l_stride_1_const_u16 = 1;
+    const ai_u16 conv_hidden_2_l_stride_0_const_u16 = 1;
+    const ai_u16 conv_hidden_2_l_dilation_H_const_u16 = 1;
+    const ai_u16 conv_hidden_2_l_dilation_W_const_u16 = 1;
+  
+  _STAI_NETWORK_EVENT_NODE_START_CB(10, 1, {(stai_ptr) conv_hidden_2_t_in_0_ptr_const_f32});
+    
+  forward_lite_conv2d_if32of32wf32(conv_hidden_2_t_in_0_ptr_const_f32, conv_hidden_2_t_out_0_ptr_f32, conv_hidden_2_t_weight_0_ptr_const_u8, conv_hidden_2_t_weight_1_ptr_const_u8, conv_hidden_2_t_scratch_0_ptr_f32, conv_hidden_2_t_in_0_shape_ch_const_u32, conv_hidden_2_t_out_0_shape_ch_const_u32, conv_hidden_2_t_in_0_shape_w_const_u32, conv_hidden_2_t_in_0_shape_h_const_u32, conv_hidden_2_t_out_0_shape_w_const_u32, conv_hidden_2_t_out_0_shape_h_const_u32, conv_hidden_2_t_weight_0_shape_w_const_u32, conv_hidden_2_t_weight_0_shape_h_const_u32, conv_hidden_2_l_pad_W_0_const_s32, conv_hidden_2_l_pad_H_0_const_s32, conv_hidden_2_l_stride_1_const_u16, conv_hidden_2_l_stride_0_const_u16, 3, 1, conv_hidden_2_l_dilation_H_const_u16, conv_hidden_2_l_dilation_W_const_u16, (ai_size)(1));
+    
+  _STAI_NETWORK_EVENT_NODE_STOP_CB(10, 1, {(stai_ptr) conv_hidden_2_t_out_0_ptr_f32});
+  }
+    break;
+    case 7: /* activation_5 */
+  {
+      ai_handle activation_5_t_out_0_ptr_handle = (ai_handle)(net_ctx->_activations[0] + 416);
+    const ai_handle activation_5_t_in_0_ptr_const_handle = (ai_handle)(net_ctx->_activations[0] + 0);
+    const ai_i32 activation_5_t_in_0_shape_ch_h_prod_const_s32 = 104;
+  
+  _STAI_NETWORK_EVENT_NODE_START_CB(11, 1, {(stai_ptr) activation_5_t_in_0_ptr_const_handle});
+    
+  forward_lite_nl_relu_if32of32(activation_5_t_out_0_ptr_handle, activation_5_t_in_0_ptr_const_handle, activation_5_t_in_0_shape_ch_h_prod_const_s32, NULL);
+    
+  _STAI_NETWORK_EVENT_NODE_STOP_CB(11, 1, {(stai_ptr) activation_5_t_out_0_ptr_handle});
+  }
+    break;
+    case 8: /* max_pooling1d_5 */
+  {
+    
+  forward_lite_mp_max_pooling1d_5(net_ctx);
+  }
+    break;
+    case 9: /* dense_out */
+  {
+      forward_lite_dense_if32of32wf32_args arg_30f51e = {
+      .output = (float*)(net_ctx->_activations[0] + 192),
+      .input = (float*)(net_ctx->_activations[0] + 0),
+      .weights = (float*)(net_ctx->_weights[0] + 1920),
+      .bias = (float*)(net_ctx->_weights[0] + 2688),
+      .n_channel_in = 48,
+      .n_channel_out = 4,
+      .n_elements = 1,
+    };
+  
+  _STAI_NETWORK_EVENT_NODE_START_CB(14, 1, {(stai_ptr) (float*)(net_ctx->_activations[0] + 0)});
+    
+  forward_lite_dense_if32of32wf32((forward_lite_dense_if32of32wf32_args*)&arg_30f51e);
+    
+  _STAI_NETWORK_EVENT_NODE_STOP_CB(14, 1, {(stai_ptr) (float*)(net_ctx->_activations[0] + 192)});
+  }
+    break;
+    case 10: /* output */
+  {
+      ai_handle output_t_out_0_ptr_handle = (ai_handle)(net_ctx->_outputs[0] + 0);
+    const ai_handle output_t_in_0_ptr_const_handle = (ai_handle)(net_ctx->_activations[0] + 192);
+    const ai_i32 output_t_in_0_shape_ch_prod_const_s32 = 4;
+  
+  _STAI_NETWORK_EVENT_NODE_START_CB(16, 1, {(stai_ptr) output_t_in_0_ptr_const_handle});
+    
+  forward_lite_nl_softmax_if32of32(output_t_out_0_ptr_handle, output_t_in_0_ptr_const_handle, output_t_in_0_shape_ch_prod_const_s32, 1, 4);
+    
+  _STAI_NETWORK_EVENT_NODE_STOP_CB(16, 1, {(stai_ptr) output_t_out_0_ptr_handle});
+  }
+    break;
+    default:
+    break;
+    }
+  }
+
+  return net_ctx->_return_code;
+}
+/* STAI_STEP END */
+
 #undef _STAI_SET_ERROR
 #undef _STAI_CONTEXT_ALIGNMENT
 #undef _STAI_CONTEXT_ACQUIRE
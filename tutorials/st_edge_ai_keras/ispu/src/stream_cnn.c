@@ -0,0 +1,143 @@
+/**
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2026 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+
+#include "stream_cnn.h"
+
+void stream_cnn_init(struct stream_cnn *cnn, const struct stream_cnn_layer *layers, uint8_t num_layers,
+		const struct stream_cnn_dense *dense)
+{
+	if (num_layers > STREAM_CNN_MAX_LAYERS) {
+		num_layers = STREAM_CNN_MAX_LAYERS;
+	}
+
+	cnn->layers = layers;
+	cnn->dense = dense;
+	cnn->num_layers = num_layers;
+
+	for (uint8_t l = 0; l < num_layers; l++) {
+		cnn->pos[l] = 0u;
+		cnn->cnt[l] = 0u;
+		(void)memset(layers[l].buf, 0, (uint32_t)layers[l].kernel * layers[l].in_ch * sizeof(float));
+	}
+
+	cnn->dense_pos = 0u;
+	cnn->dense_cnt = 0u;
+}
+
+bool stream_cnn_run(struct stream_cnn *cnn, const float *sample, float *output)
+{
+	const float *in = sample;
+
+	for (uint8_t l = 0; l < cnn->num_layers; l++) {
+		const struct stream_cnn_layer *layer = &cnn->layers[l];
+		uint8_t in_ch = layer->in_ch;
+		uint8_t kernel = layer->kernel;
+		float *pool = &layer->buf[kernel * in_ch];
+
+		// the input frames are kept in a ring buffer, after the update pos is the oldest one
+		(void)memcpy(&layer->buf[cnn->pos[l] * in_ch], in, in_ch * sizeof(float));
+		if (++cnn->pos[l] == kernel) {
+			cnn->pos[l] = 0u;
+		}
+
+		const float *w = layer->weights;
+		for (uint8_t co = 0; co < layer->out_ch; co++) {
+			float y = layer->bias[co];
+			uint8_t k = cnn->pos[l];
+
+			for (uint8_t j = 0; j < kernel; j++) {
+				const float *x = &layer->buf[k * in_ch];
+				for (uint8_t ci = 0; ci < in_ch; ci++) {
+					y += w[ci] * x[ci];
+				}
+				w += in_ch;
+				if (++k == kernel) {
+					k = 0u;
+				}
+			}
+
+			y = (y > 0.0f) ? y : 0.0f;
+			if (layer->bn_scale != NULL) {
+				y = y * layer->bn_scale[co] + layer->bn_offset[co];
+			}
+
+			if (cnn->cnt[l] == 0u || y > pool[co]) {
+				pool[co] = y;
+			}
+		}
+
+		// the next layers are run only when the pooling window is complete
+		if (++cnn->cnt[l] < layer->pool) {
+			return false;
+		}
+		cnn->cnt[l] = 0u;
+		in = pool;
+	}
+
+	const struct stream_cnn_dense *dense = cnn->dense;
+	uint8_t ch = dense->ch;
+
+	(void)memcpy(&dense->buf[cnn->dense_pos * ch], in, ch * sizeof(float));
+	if (++cnn->dense_pos == dense->frames) {
+		cnn->dense_pos = 0u;
+	}
+
+	if (cnn->dense_cnt < dense->frames) {
+		cnn->dense_cnt++;
+		if (cnn->dense_cnt < dense->frames) {
+			return false;
+		}
+	}
+
+	// dense layer on the flattened frames, from the oldest to the newest
+	const float *w = dense->weights;
+	float max = 0.0f;
+	for (uint8_t o = 0; o < dense->out; o++) {
+		float y = dense->bias[o];
+		uint16_t k = cnn->dense_pos;
+
+		for (uint16_t j = 0; j < dense->frames; j++) {
+			const float *x = &dense->buf[k * ch];
+			for (uint8_t c = 0; c < ch; c++) {
+				y += w[c] * x[c];
+			}
+			w += ch;
+			if (++k == dense->frames) {
+				k = 0u;
+			}
+		}
+
+		output[o] = y;
+		if (o == 0u || y > max) {
+			max = y;
+		}
+	}
+
+	float sum = 0.0f;
+	for (uint8_t o = 0; o < dense->out; o++) {
+		output[o] = expf(output[o] - max);
+		sum += output[o];
+	}
+	for (uint8_t o = 0; o < dense->out; o++) {
+		output[o] /= sum;
+	}
+
+	return true;
+}
+